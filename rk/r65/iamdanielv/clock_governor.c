@@ -0,0 +1,85 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "clock_governor.h"
+#include "quantum.h"
+#include "matrix_scan.h"
+#include "rgb_pipeline.h"
+
+// RCC->AHBPRE holds the AHB divider less one
+#define CLOCK_AHBPRE(div) ((div)-1)
+
+_Static_assert(CLOCK_GOVERNOR_SLOW_DIV >= 1 && CLOCK_GOVERNOR_SLOW_DIV <= 8, "CLOCK_GOVERNOR_SLOW_DIV: USB needs the core at 12MHz or more");
+
+uint8_t clock_governor_div = 1;
+
+#if CH_CFG_ST_TIMEDELTA == 0
+/**
+ * @brief Moves SysTick to a new period, keeping the part of the current tick still to run.
+ *
+ * Writing VAL always clears it, so the rest of the tick, scaled to the new
+ * clock, goes into LOAD for one reload, then LOAD gets the full period for
+ * the ticks after it. Call with the system locked.
+ */
+static void systick_rescale(uint32_t period) {
+    uint32_t rest = (uint64_t)SysTick->VAL * period / (SysTick->LOAD + 1);
+    if (rest > 1) {
+        SysTick->LOAD = rest - 1;
+        SysTick->VAL  = 0;
+        // the counter reloads on its next clock, LOAD can only change after that
+        while (SysTick->VAL == 0) {
+        }
+    }
+    // takes effect at the next reload, a tick that ended meanwhile is still pending
+    SysTick->LOAD = period - 1;
+}
+#endif
+
+/**
+ * @brief Runs the core at CPU_CLOCK / `slow_div`.
+ */
+static void clock_set(uint8_t slow_div) {
+    osalSysLock();
+    RCC->AHBPRE = CLOCK_AHBPRE(WB32_HPRE * slow_div);
+#if CH_CFG_ST_TIMEDELTA == 0
+    // SysTick runs from the core clock, keep it at CH_CFG_ST_FREQUENCY
+    systick_rescale((CPU_CLOCK / slow_div) / CH_CFG_ST_FREQUENCY);
+#endif
+    osalSysUnlock();
+}
+
+void clock_governor_boost(void) {
+    if (clock_governor_div != 1) {
+        clock_set(1);
+        clock_governor_div = 1;
+    }
+}
+
+void clock_governor_slow(void) {
+    if (clock_governor_div != CLOCK_GOVERNOR_SLOW_DIV) {
+        clock_set(CLOCK_GOVERNOR_SLOW_DIV);
+        clock_governor_div = CLOCK_GOVERNOR_SLOW_DIV;
+    }
+}
+
+bool clock_governor_is_slow(void) {
+    return clock_governor_div != 1;
+}
+
+void clock_governor_wait_us(uint32_t us) {
+    // wait_us() counts CPU_CLOCK cycles, which take clock_governor_div times longer at the slow clock
+    us = (us + clock_governor_div - 1) / clock_governor_div;
+    if (us) {
+        wait_us(us);
+    }
+}
+
+void clock_governor_task(void) {
+    bool idle = matrix_scan_is_idle() && rgb_pipeline_unchanged_ms() >= CLOCK_GOVERNOR_RGB_STILL_MS;
+
+    if (idle) {
+        clock_governor_slow();
+    } else {
+        clock_governor_boost();
+    }
+}
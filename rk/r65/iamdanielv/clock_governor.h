@@ -0,0 +1,73 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// AHB divider while idle, 96MHz / 4 = 24MHz
+#ifndef CLOCK_GOVERNOR_SLOW_DIV
+#    define CLOCK_GOVERNOR_SLOW_DIV 4
+#endif
+
+// How long the LEDs must stay unchanged before the core slows down
+#ifndef CLOCK_GOVERNOR_RGB_STILL_MS
+#    define CLOCK_GOVERNOR_RGB_STILL_MS 1000
+#endif
+
+/**
+ * The core runs at full speed while anything is happening, and drops to
+ * CPU_CLOCK / CLOCK_GOVERNOR_SLOW_DIV once the matrix scan is idle (see
+ * matrix.c) and the LEDs have not changed for CLOCK_GOVERNOR_RGB_STILL_MS,
+ * which also covers RGB being off.
+ *
+ * Only the AHB divider changes. The PLL, and with it the USB clock and the
+ * APB clocks feeding SPI and the timers, stay as set up in mcuconf.h, and
+ * SysTick is reloaded for the new core clock so timer_read() keeps counting
+ * milliseconds, and wait_ms() with it. The tick running at the switch keeps
+ * its remaining time, scaled to the new clock.
+ *
+ * wait_us() and the DWT cycle counter count core cycles, so they run slow by
+ * the divider. Busy-waits that can run at the slow clock use
+ * clock_governor_wait_us(), and CYCLES_PER_US (see cycles.h) follows the
+ * current divider.
+ *
+ * The slow clock is only entered from clock_governor_task() in housekeeping
+ * and from suspend_power_down_kb(). Code that can run at it, and so must not
+ * call wait_us() directly:
+ *   - the main loop pass after housekeeping slowed down, up to the next
+ *     housekeeping (matrix scan and its idle entry, RGB and encoder tasks)
+ *   - the suspend loop, and suspend_wakeup_init_kb() before its boost
+ *   - interrupt handlers (matrix row edges, encoder edges, USB)
+ * Code that calls clock_governor_boost() first, like the effect benchmark and
+ * rgb_pipeline_resume(), runs at full speed and can use wait_us().
+ */
+
+// AHB divider the core runs at right now, 1 at full speed
+extern uint8_t clock_governor_div;
+
+/**
+ * @brief Picks the clock for what the keyboard is doing, called from housekeeping.
+ */
+void clock_governor_task(void);
+
+/**
+ * @brief Drops to the slow clock right away, for USB suspend when housekeeping doesn't run.
+ */
+void clock_governor_slow(void);
+
+/**
+ * @brief Goes back to the full clock right away.
+ */
+void clock_governor_boost(void);
+
+/**
+ * @brief Returns true while the core runs at the slow clock.
+ */
+bool clock_governor_is_slow(void);
+
+/**
+ * @brief Busy-waits `us` microseconds at whichever clock the core runs at.
+ */
+void clock_governor_wait_us(uint32_t us);
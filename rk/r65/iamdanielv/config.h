@@ -7,6 +7,7 @@
 // #define WEAR_LEVELING_BACKING_SIZE 4096 // defined in keyboard.json
 
 // #define LED_CAPS_LOCK_PIN B0 // defined in keyboard.json
+#define LED_ENABLE_PIN A5 // powers the RGB LEDs, high is on
 #define LED_WIN_LOCK_PIN B10
 #define LED_MAC_PIN B11
 
@@ -27,7 +28,13 @@
 
 /* WS2812 */
 #define WS2812_SPI_DRIVER SPIDM2
-#define WS2812_SPI_DIVISOR 32
+// 3 SPI bits per LED bit, 9 bytes per LED instead of 12, see ws2812_compact.c
+// remove both lines to go back to the 4 bit encoding at a divisor of 32
+#define WS2812_SPI_3BIT
+#define WS2812_SPI_DIVISOR 40
+
+// Dim the whole frame if the LEDs would draw more than this, see rgb_pipeline.c
+#define RGB_POWER_BUDGET_MA 400
 
 // Set defaults for LED matrix
 #define RGB_MATRIX_DEFAULT_MODE RGB_MATRIX_SOLID_COLOR
@@ -0,0 +1,26 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "hal.h"
+#include "clock_governor.h"
+
+// CPU cycles per microsecond at the current core clock, for turning microsecond budgets into cycles
+#define CYCLES_PER_US (CPU_CLOCK / 1000000UL / clock_governor_div)
+
+/**
+ * @brief Starts the DWT cycle counter, safe to call more than once.
+ */
+static inline void cycles_enable(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNT_ENA_Msk;
+}
+
+/**
+ * @brief Returns the DWT cycle counter, wraps every ~44s at 96MHz so only use differences.
+ */
+static inline uint32_t cycles_read(void) {
+    return DWT->CYCCNT;
+}
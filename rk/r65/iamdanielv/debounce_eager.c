@@ -0,0 +1,159 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+#include "debounce.h"
+
+/**
+ * Per key debounce, eager on press and deferred on release (DEBOUNCE_TYPE = custom, see rules.mk).
+ *
+ *   - a press is reported on the first scan that sees it, then the key is
+ *     locked for DEBOUNCE_PRESS_LOCK_MS so the press bounce is ignored
+ *   - a release is only reported once the key has read released for
+ *     DEBOUNCE_RELEASE_MS in a row, keys in DEBOUNCE_CHATTER_ROWS wait
+ *     DEBOUNCE_CHATTER_MS instead
+ *
+ * Every key has a 4 bit ms countdown, stored as vertical counters: bit n of
+ * every key's counter lives in counter[n][row], so all the keys of a row are
+ * counted down, loaded and tested with a handful of bitwise operations on
+ * the row words instead of a loop over the keys.
+ */
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// How long a key ignores bounce after a press was reported
+#ifndef DEBOUNCE_PRESS_LOCK_MS
+#    define DEBOUNCE_PRESS_LOCK_MS DEBOUNCE
+#endif
+
+// How long a key must read released before the release is reported
+#ifndef DEBOUNCE_RELEASE_MS
+#    define DEBOUNCE_RELEASE_MS DEBOUNCE
+#endif
+
+// Release wait for the keys in DEBOUNCE_CHATTER_ROWS
+#ifndef DEBOUNCE_CHATTER_MS
+#    define DEBOUNCE_CHATTER_MS 12
+#endif
+
+// Keys whose switches are known to chatter, one mask per row with bit n for column n
+#ifndef DEBOUNCE_CHATTER_ROWS
+#    define DEBOUNCE_CHATTER_ROWS {0}
+#endif
+
+#define COUNTER_BITS 4
+#define COUNTER_MAX ((1 << COUNTER_BITS) - 1)
+
+_Static_assert(DEBOUNCE_PRESS_LOCK_MS <= COUNTER_MAX && DEBOUNCE_RELEASE_MS <= COUNTER_MAX && DEBOUNCE_CHATTER_MS <= COUNTER_MAX, "debounce_eager.c: debounce times must fit the 4 bit counters (15ms)");
+_Static_assert(DEBOUNCE_RELEASE_MS > 0 && DEBOUNCE_CHATTER_MS > 0, "debounce_eager.c: release times must be at least 1ms");
+
+static const matrix_row_t chatter_rows[MATRIX_ROWS] = DEBOUNCE_CHATTER_ROWS;
+
+// the vertical counters, bit n of each key's countdown
+static matrix_row_t counter[COUNTER_BITS][MATRIX_ROWS];
+
+// keys waiting out a release, the rest of the running counters are press locks
+static matrix_row_t release_pending[MATRIX_ROWS];
+
+// keys with a counter above zero, cached so idle rows can be skipped
+static matrix_row_t counting[MATRIX_ROWS];
+
+static uint16_t last_tick = 0;
+
+/**
+ * @brief Sets the counters of the keys in `mask` to `value`.
+ */
+static inline void counter_load(uint8_t row, matrix_row_t mask, uint8_t value) {
+    for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+        counter[bit][row] = (counter[bit][row] & ~mask) | ((value >> bit) & 1 ? mask : 0);
+    }
+}
+
+/**
+ * @brief Counts every running counter in the row down by one, stopping at zero.
+ */
+static inline void counter_tick(uint8_t row) {
+    // subtract 1 from the counters in `counting`, the borrow moves up while the bits are 0
+    matrix_row_t borrow = counting[row];
+    for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+        matrix_row_t was = counter[bit][row];
+        counter[bit][row] = was ^ borrow;
+        borrow &= ~was;
+    }
+
+    matrix_row_t running = 0;
+    for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+        running |= counter[bit][row];
+    }
+    counting[row] = running;
+}
+
+void debounce_init(uint8_t num_rows) {
+    (void)num_rows;
+    memset(counter, 0, sizeof(counter));
+    memset(release_pending, 0, sizeof(release_pending));
+    memset(counting, 0, sizeof(counting));
+    last_tick = timer_read();
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    uint16_t elapsed = timer_elapsed(last_tick);
+    if (elapsed > 0) {
+        last_tick += elapsed;
+    }
+    uint8_t ticks = elapsed > COUNTER_MAX ? COUNTER_MAX : elapsed;
+
+    bool cooked_changed = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        if (!changed && counting[row] == 0 && raw[row] == cooked[row]) {
+            continue; // nothing to do for this row
+        }
+
+        for (uint8_t i = 0; i < ticks && counting[row]; i++) {
+            counter_tick(row);
+        }
+
+        matrix_row_t cooked_row = cooked[row];
+
+        // a key that reads pressed again while waiting to release never left
+        matrix_row_t bounced_back = release_pending[row] & raw[row];
+        release_pending[row] &= ~bounced_back;
+        counter_load(row, bounced_back, 0);
+        counting[row] &= ~bounced_back;
+
+        matrix_row_t idle = ~counting[row];
+
+        // releases that stayed released for the whole wait
+        matrix_row_t released = release_pending[row] & idle;
+        release_pending[row] &= ~released;
+        cooked_row &= ~released;
+
+        // presses go out at once, then the key is locked
+        matrix_row_t pressed = raw[row] & ~cooked_row & idle;
+        cooked_row |= pressed;
+        if (pressed) {
+            counter_load(row, pressed, DEBOUNCE_PRESS_LOCK_MS);
+            counting[row] |= DEBOUNCE_PRESS_LOCK_MS ? pressed : 0;
+        }
+
+        // keys that read released start their wait
+        matrix_row_t releasing = ~raw[row] & cooked_row & idle & ~release_pending[row];
+        if (releasing) {
+            release_pending[row] |= releasing;
+            counter_load(row, releasing & ~chatter_rows[row], DEBOUNCE_RELEASE_MS);
+            counter_load(row, releasing & chatter_rows[row], DEBOUNCE_CHATTER_MS);
+            counting[row] |= releasing;
+        }
+
+        if (cooked_row != cooked[row]) {
+            cooked[row]    = cooked_row;
+            cooked_changed = true;
+        }
+    }
+
+    return cooked_changed;
+}
@@ -0,0 +1,91 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+#include "encoder.h"
+
+/**
+ * Rotary encoder decoded from pin edges (custom encoder driver, see keyboard.json).
+ *
+ * Both pins of every encoder fire a PAL callback on each edge. The callback
+ * reads the pins, looks the old and new states up in the quadrature table
+ * and adds the result to the encoder's pulse counter, so no edge is lost
+ * however long the main loop is busy. encoder_driver_task() takes the
+ * pulses in one go and queues a QMK encoder event per ENCODER_RESOLUTION
+ * pulses, at most MAX_QUEUED_ENCODER_EVENTS per pass, anything left over
+ * stays counted for the next pass.
+ */
+
+#ifndef ENCODER_RESOLUTION
+#    define ENCODER_RESOLUTION 4
+#endif
+
+static const pin_t encoder_a_pins[NUM_ENCODERS] = ENCODER_A_PINS;
+static const pin_t encoder_b_pins[NUM_ENCODERS] = ENCODER_B_PINS;
+
+// old state in bits 3:2, new state in bits 1:0, each as b << 1 | a
+static const int8_t quadrature_table[16] = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0};
+
+// only touched by the pin callbacks
+static uint8_t encoder_state[NUM_ENCODERS];
+
+// pulses counted by the callbacks and not yet taken by the task
+static volatile int16_t encoder_pending[NUM_ENCODERS];
+
+// pulses taken that haven't made a whole detent yet, main loop only
+static int16_t encoder_pulses[NUM_ENCODERS];
+
+static inline uint8_t encoder_read(uint8_t index) {
+    return (palReadLine(encoder_b_pins[index]) << 1) | palReadLine(encoder_a_pins[index]);
+}
+
+static void encoder_edge(void *arg) {
+    uint8_t index = (uint8_t)(uintptr_t)arg;
+
+    osalSysLockFromISR();
+    encoder_state[index] = ((encoder_state[index] << 2) | encoder_read(index)) & 0xF;
+    encoder_pending[index] += quadrature_table[encoder_state[index]];
+    osalSysUnlockFromISR();
+}
+
+void encoder_driver_init(void) {
+    for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+        gpio_set_pin_input_high(encoder_a_pins[i]);
+        gpio_set_pin_input_high(encoder_b_pins[i]);
+    }
+    // let the pull-ups settle before the first state is read
+    wait_us(100);
+
+    for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+        encoder_state[i]   = encoder_read(i);
+        encoder_pending[i] = 0;
+        encoder_pulses[i]  = 0;
+
+        palEnableLineEvent(encoder_a_pins[i], PAL_EVENT_MODE_BOTH_EDGES);
+        palSetLineCallback(encoder_a_pins[i], encoder_edge, (void *)(uintptr_t)i);
+        palEnableLineEvent(encoder_b_pins[i], PAL_EVENT_MODE_BOTH_EDGES);
+        palSetLineCallback(encoder_b_pins[i], encoder_edge, (void *)(uintptr_t)i);
+    }
+}
+
+void encoder_driver_task(void) {
+    uint8_t queued = 0;
+
+    for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+        osalSysLock();
+        encoder_pulses[i] += encoder_pending[i];
+        encoder_pending[i] = 0;
+        osalSysUnlock();
+
+        while (encoder_pulses[i] >= ENCODER_RESOLUTION && queued < MAX_QUEUED_ENCODER_EVENTS) {
+            encoder_queue_event(i, ENCODER_COUNTER_CLOCKWISE);
+            encoder_pulses[i] -= ENCODER_RESOLUTION;
+            queued++;
+        }
+        while (encoder_pulses[i] <= -ENCODER_RESOLUTION && queued < MAX_QUEUED_ENCODER_EVENTS) {
+            encoder_queue_event(i, ENCODER_CLOCKWISE);
+            encoder_pulses[i] += ENCODER_RESOLUTION;
+            queued++;
+        }
+    }
+}
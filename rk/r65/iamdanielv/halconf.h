@@ -4,6 +4,7 @@
 #pragma once
 
 #define HAL_USE_SPI TRUE
+#define HAL_USE_GPT TRUE
 #define PAL_USE_CALLBACKS TRUE
 
 #include_next <halconf.h>
@@ -1,6 +1,26 @@
 #include QMK_KEYBOARD_H
+#include "rgb_pipeline.h"
+#include "clock_governor.h"
+#include "matrix_scan.h"
+#include "report_coalesce.h"
+#include "spi_master.h"
+#include "flash_spi.h"
 
-#define LED_ENABLE_PIN A5
+// SPI flash commands for the wear leveling flash on C12
+#define FLASH_CMD_DEEP_POWER_DOWN 0xB9
+#define FLASH_CMD_RELEASE_POWER_DOWN 0xAB
+
+// time the flash needs to come out of deep power down (tRES1 is 3us on most parts)
+#define FLASH_RELEASE_US 30
+
+static bool deep_suspended = false;
+
+static void flash_command(uint8_t command) {
+    if (spi_start(EXTERNAL_FLASH_SPI_SLAVE_SELECT_PIN, EXTERNAL_FLASH_SPI_LSBFIRST, EXTERNAL_FLASH_SPI_MODE, EXTERNAL_FLASH_SPI_CLOCK_DIVISOR)) {
+        spi_write(command);
+        spi_stop();
+    }
+}
 
 void keyboard_pre_init_kb(void) {
     gpio_set_pin_output(LED_ENABLE_PIN);
@@ -21,15 +41,36 @@ void keyboard_pre_init_kb(void) {
 }
 
 void suspend_power_down_kb(void) {
-    // turn off our RGB LEDs
-    gpio_write_pin_low(LED_ENABLE_PIN);
+    // called on every pass of the suspend loop, only power down once
+    if (!deep_suspended) {
+        deep_suspended = true;
+
+        // turn off our RGB LEDs and their SPI peripheral, the frame is kept for the wakeup
+        rgb_pipeline_suspend();
+
+        // the flash is idle until we wake, spi_stop() has already stopped QSPI
+        flash_command(FLASH_CMD_DEEP_POWER_DOWN);
+
+        // scan only on a row edge and sleep with WFI in between, a press still wakes the host
+        matrix_scan_sleep();
+        clock_governor_slow();
+    }
 
     suspend_power_down_user();
 }
 
 void suspend_wakeup_init_kb(void) {
-    // turn on our RGB LEDs
-    gpio_write_pin_high(LED_ENABLE_PIN);
+    if (deep_suspended) {
+        deep_suspended = false;
+
+        clock_governor_boost();
+
+        flash_command(FLASH_CMD_RELEASE_POWER_DOWN);
+        clock_governor_wait_us(FLASH_RELEASE_US);
+
+        // turn on our RGB LEDs with the frame from before the suspend
+        rgb_pipeline_resume();
+    }
 
     suspend_wakeup_init_user();
 }
@@ -39,6 +80,11 @@ void housekeeping_task_kb(void) {
     // put the code in a function with this signature
     // void housekeeping_task_user(void) { }
 
+    clock_governor_task();
+
+    // puts the report filter in front of the USB driver, and sends the report merged over this pass
+    report_coalesce_task();
+
     if (keymap_config.no_gui) {
         // we have enabled the no_gui, so turn on the Win Lock LED
         gpio_write_pin_low(LED_WIN_LOCK_PIN);
@@ -9,6 +9,7 @@
 // #define PALETTEFX_SPARKLE_ENABLE
 #define PALETTEFX_VORTEX_ENABLE
 // #define PALETTEFX_REACTIVE_ENABLE
+#define PALETTEFX_HEATMAP_ENABLE
 
 #define PALETTEFX_AFTERBURN_ENABLE
 #define PALETTEFX_AMBER_ENABLE
@@ -27,4 +28,32 @@
 #define PALETTEFX_VIRIDIS_ENABLE
 // #define PALETTEFX_WATERMELON_ENABLE
 
+// Palettes loaded at runtime from EEPROM, placed after the built-in palettes.
+// See features/user_palettes.c, they are edited over raw HID.
+#define PALETTEFX_USER_PALETTE_COUNT 4
+
+// Per-layer key color maps, 81 bytes each, see features/key_color_map.c
+#define KEY_COLOR_MAP_COUNT 6
+
+// user datablock: the user palettes, then the key color maps
+#define EECONFIG_USER_DATA_SIZE ((2 + PALETTEFX_USER_PALETTE_COUNT * 32) + (2 + KEY_COLOR_MAP_COUNT * 81))
+
+// Frame interval chosen at runtime by the governor, see features/rgb_governor.c
+#ifndef __ASSEMBLER__
+#    include <stdint.h>
+uint32_t rgb_governor_flush_limit(void);
+#endif
+#define RGB_MATRIX_LED_FLUSH_LIMIT rgb_governor_flush_limit()
+
+// LEDs rendered per iteration, tuned at runtime by features/led_budget.c.
+// It is written as 1 + a variable so the `#if` check in rgb_matrix.h, where the
+// variable reads as 0, still sees a valid limit and splits the frame.
+#ifndef __ASSEMBLER__
+extern uint8_t led_budget_extra;
+#endif
+#define RGB_MATRIX_LED_PROCESS_LIMIT (1 + led_budget_extra)
+
+// The knob scrolls with the high resolution wheel on NUM_LYR, see features/hires_scroll.c
+#define POINTING_DEVICE_HIRES_SCROLL_ENABLE
+
 #define NKRO_DEFAULT_ON false
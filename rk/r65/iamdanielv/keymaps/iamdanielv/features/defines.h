@@ -35,95 +35,26 @@ enum layer_names {
 // * Key Indexes *
 // ***************
 
-#define ESC_KI 56
-#define BSPC_KI 43
-
-// Modifiers
-#define GRV_KI 56
-#define TAB_KI 29
-#define CAPS_KI 28
-#define LEFT_SFT_KI 3
-#define LEFT_CTL_KI 2
-#define LEFT_WIN_KI 1
-#define LEFT_ALT_KI 0
-#define SPACE_KI 65
-#define FN_KI 63
-#define RIGHT_ALT_KI 64
-#define RIGHT_SFT_KI 14
-#define ENTER_KI 16
-#define HOME_KI 57
-#define PGUP_KI 58
-#define PGDN_KI 59
-
-// Letter Keys
-#define A_KI 27
-#define B_KI 8
-#define C_KI 6
-#define D_KI 25
-#define E_KI 32
-#define F_KI 24
-#define G_KI 23
-#define H_KI 22
-#define I_KI 37
-#define J_KI 21
-#define K_KI 20
-#define L_KI 19
-#define M_KI 10
-#define N_KI 9
-#define O_KI 38
-#define P_KI 39
-#define Q_KI 30
-#define R_KI 33
-#define S_KI 26
-#define T_KI 34
-#define U_KI 36
-#define V_KI 7
-#define W_KI 31
-#define X_KI 5
-#define Y_KI 35
-#define Z_KI 4
-
-// number keys
-#define N1_KI 55
-#define N2_KI 54
-#define N3_KI 53
-#define N4_KI 52
-#define N5_KI 51
-#define N6_KI 50
-#define N7_KI 49
-#define N8_KI 48
-#define N9_KI 47
-#define N0_KI 46
+// The <LABEL>_KI constants for every key with an LED are generated from the
+// "label" fields of the LAYOUT in keyboard.json, see tools/gen_led_tables.py
+#include "led_index_tables.h"
+
+// the same LEDs under the names of other layers
+#define GRV_KI ESC_KI
 
 // F Keys
-#define FN1_KI 55
-#define FN2_KI 54
-#define FN3_KI 53
-#define FN4_KI 52
-#define FN5_KI 51
-#define FN6_KI 50
-#define FN7_KI 49
-#define FN8_KI 48
-#define FN9_KI 47
-#define FN10_KI 46
-#define FN11_KI 45
-#define FN12_KI 44
-
-// symbols
-#define COMM_KI 11 // ,
-#define DOT_KI 12  // .
-#define BSLS_KI 42 // \ backslash
-#define SLSH_KI 13 // / forwardslash
-#define SCLN_KI 18 // ;
-#define QUOT_KI 17 // '
-#define MINS_KI 45 // -
-#define EQL_KI 44  // =
-
-// arrows
-#define UP_KI 15
-#define LEFT_KI 62
-#define DOWN_KI 61
-#define RIGHT_KI 60
+#define FN1_KI N1_KI
+#define FN2_KI N2_KI
+#define FN3_KI N3_KI
+#define FN4_KI N4_KI
+#define FN5_KI N5_KI
+#define FN6_KI N6_KI
+#define FN7_KI N7_KI
+#define FN8_KI N8_KI
+#define FN9_KI N9_KI
+#define FN10_KI N0_KI
+#define FN11_KI MINS_KI
+#define FN12_KI EQL_KI
 
 // ******************************
 // * Aliases to simplify keymap *
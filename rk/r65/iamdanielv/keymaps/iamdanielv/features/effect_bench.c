@@ -0,0 +1,93 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "effect_bench.h"
+#include <stdlib.h>
+#include "quantum.h"
+#include "lib/lib8tion/lib8tion.h"
+#include "hid_commands.h"
+#include "rgb_pipeline.h"
+#include "cycles.h"
+#include "clock_governor.h"
+
+// Far enough ahead of the uptime that the flush limit never makes us wait
+#define BENCH_TIME_BASE 0x80000000UL
+
+#define FNV_OFFSET 2166136261UL
+#define FNV_PRIME 16777619UL
+
+static uint32_t frame_checksum(uint32_t hash) {
+    const uint8_t *bytes = (const uint8_t *)rgb_pipeline_frame();
+    for (uint16_t i = 0; i < RGB_MATRIX_LED_COUNT * sizeof(rgb_t); i++) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+static void put_u32(uint8_t *out, uint32_t value) {
+    out[0] = value & 0xFF;
+    out[1] = (value >> 8) & 0xFF;
+    out[2] = (value >> 16) & 0xFF;
+    out[3] = value >> 24;
+}
+
+uint8_t effect_bench_hid_command(uint8_t *data, uint8_t length) {
+    uint8_t *args   = &data[HID_CMD_ARGS];
+    uint8_t  mode   = args[0];
+    uint8_t  speed  = args[1];
+    uint8_t  frames = args[2] ? args[2] : EFFECT_BENCH_DEFAULT_FRAMES;
+
+    if (mode == RGB_MATRIX_NONE || mode >= RGB_MATRIX_EFFECT_MAX || length < HID_CMD_DATA + 15) {
+        return HID_STATUS_BAD_ARGS;
+    }
+    if (!rgb_matrix_is_enabled()) {
+        return HID_STATUS_UNAVAILABLE;
+    }
+
+    uint8_t saved_mode  = rgb_matrix_get_mode();
+    uint8_t saved_speed = rgb_matrix_get_speed();
+
+    // cycle counts are only comparable at the full clock
+    clock_governor_boost();
+    cycles_enable();
+    srand(EFFECT_BENCH_SEED);
+    random16_set_seed(EFFECT_BENCH_SEED);
+    rgb_pipeline_hold(true);
+    rgb_matrix_mode_noeeprom(mode);
+    rgb_matrix_set_speed_noeeprom(speed);
+
+    uint32_t total    = 0;
+    uint32_t worst    = 0;
+    uint32_t checksum = FNV_OFFSET;
+    for (uint8_t frame = 0; frame < frames; frame++) {
+        uint32_t flushed = rgb_pipeline_frame_count();
+        uint32_t start   = cycles_read();
+        // the task renders a few LEDs per call, keep going until the frame is flushed
+        do {
+            g_rgb_timer = BENCH_TIME_BASE + (uint32_t)frame * EFFECT_BENCH_FRAME_MS;
+            rgb_matrix_task();
+        } while (rgb_pipeline_frame_count() == flushed);
+        uint32_t cycles = cycles_read() - start;
+
+        total += cycles;
+        if (cycles > worst) {
+            worst = cycles;
+        }
+        checksum = frame_checksum(checksum);
+    }
+
+    rgb_matrix_mode_noeeprom(saved_mode);
+    rgb_matrix_set_speed_noeeprom(saved_speed);
+    rgb_pipeline_hold(false);
+
+    uint8_t *reply    = &data[HID_CMD_DATA];
+    uint32_t average  = total / frames;
+    uint16_t per_led  = average / RGB_MATRIX_LED_COUNT;
+    put_u32(&reply[0], average);
+    put_u32(&reply[4], worst);
+    reply[8]  = per_led & 0xFF;
+    reply[9]  = per_led >> 8;
+    put_u32(&reply[10], checksum);
+    reply[14] = frames;
+    return HID_STATUS_OK;
+}
@@ -0,0 +1,51 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+// Number of frames rendered when the request asks for 0
+#ifndef EFFECT_BENCH_DEFAULT_FRAMES
+#    define EFFECT_BENCH_DEFAULT_FRAMES 64
+#endif
+
+// Effect time between two rendered frames, fixed so the governor can't change the output
+#ifndef EFFECT_BENCH_FRAME_MS
+#    define EFFECT_BENCH_FRAME_MS 16
+#endif
+
+// Seed for rand() and random8() so random effects render the same frames every run
+#ifndef EFFECT_BENCH_SEED
+#    define EFFECT_BENCH_SEED 1337
+#endif
+
+/**
+ * Effect benchmark
+ *
+ * Renders N frames of an effect on the keyboard itself, through the real
+ * rgb_matrix_task() and the RGB pipeline, while the pipeline is held so nothing
+ * is sent to the LEDs. The effect clock (g_rgb_timer) is replaced with a fixed
+ * timeline that advances EFFECT_BENCH_FRAME_MS per frame, so the same mode and
+ * speed always produce the same frames and the checksum can be compared
+ * before and after an optimisation.
+ *
+ * Frame cost is measured with the DWT cycle counter and includes the indicators.
+ *
+ * tools/bench_sweep.py runs it for every mode and a list of speeds and writes
+ * a CSV, and compares the checksums against an earlier sweep with --compare.
+ * tests/bench_palettefx.c renders the PaletteFx effects the same way on the
+ * host, `make -C tests bench`.
+ */
+
+/**
+ * @brief Handles the HID_CMD_BENCH_RUN raw HID command.
+ *
+ * request: [mode] [speed] [frames]
+ * reply:   [cycles per frame u32] [worst frame u32] [cycles per LED u16] [checksum u32] [frames]
+ *
+ * @param data The packet, the reply data is written back into it.
+ * @param length The length of the packet.
+ * @return One of `hid_command_status`.
+ */
+uint8_t effect_bench_hid_command(uint8_t *data, uint8_t length);
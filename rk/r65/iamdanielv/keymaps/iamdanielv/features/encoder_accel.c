@@ -0,0 +1,106 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "encoder_accel.h"
+
+typedef struct {
+    uint16_t last_detent;   // timer at the last detent
+    uint16_t average_ms;    // running average of the time between detents
+    bool     clockwise;     // direction of the last detent
+    int16_t  pending;       // steps still to send, positive is clockwise
+    uint16_t keycode_cw;    // what to send for the steps
+    uint16_t keycode_ccw;
+} encoder_accel_state_t;
+
+static encoder_accel_state_t accel_state[NUM_ENCODERS];
+static uint16_t              last_send = 0;
+
+/**
+ * @brief Returns how many steps a detent is worth at the averaged speed.
+ */
+static uint8_t accel_steps(const encoder_accel_t *accel, uint16_t average_ms) {
+    if (average_ms >= accel->slow_ms || accel->slow_ms <= accel->fast_ms) {
+        return 1;
+    }
+    if (average_ms <= accel->fast_ms) {
+        return accel->max_steps;
+    }
+
+    // 0 - 256 from slow to fast, squared so the steps only pick up on a quick spin
+    uint32_t x = ((uint32_t)(accel->slow_ms - average_ms) << 8) / (accel->slow_ms - accel->fast_ms);
+    return 1 + (((accel->max_steps - 1) * x * x) >> 16);
+}
+
+bool process_encoder_accel(uint16_t keycode, keyrecord_t *record) {
+    if (!IS_ENCODEREVENT(record->event)) {
+        return true;
+    }
+
+    uint8_t index = record->event.key.col;
+    uint8_t layer = layer_switch_get_layer(record->event.key);
+    if (index >= NUM_ENCODERS || layer >= encoder_accel_map_count) {
+        return true;
+    }
+
+    encoder_accel_t accel;
+    memcpy_P(&accel, &encoder_accel_map[layer][index], sizeof(accel));
+    if (accel.max_steps == 0) {
+        return true;
+    }
+    if (!record->event.pressed) {
+        return false; // the step is sent as a whole tap by encoder_accel_task()
+    }
+
+    encoder_accel_state_t *state     = &accel_state[index];
+    bool                   clockwise = record->event.type == ENCODER_CW_EVENT;
+    uint16_t               elapsed   = timer_elapsed(state->last_detent);
+    state->last_detent               = timer_read();
+
+    if (clockwise != state->clockwise || elapsed >= accel.slow_ms) {
+        // turning back or starting again, begin from a single step
+        state->average_ms = accel.slow_ms;
+        state->clockwise  = clockwise;
+    } else {
+        state->average_ms = (state->average_ms * 3 + elapsed) / 4;
+    }
+
+    // Past ENCODER_ACCEL_MAX_PENDING waiting steps a detent only adds its own
+    // step. The backlog stops growing with the acceleration, and no detent is lost.
+    int16_t steps = accel_steps(&accel, state->average_ms);
+    int16_t room  = ENCODER_ACCEL_MAX_PENDING - (clockwise ? state->pending : -state->pending);
+    if (steps > room) {
+        steps = room > 1 ? room : 1;
+    }
+
+    if (clockwise) {
+        state->keycode_cw = keycode;
+    } else {
+        state->keycode_ccw = keycode;
+    }
+    state->pending += clockwise ? steps : -steps;
+
+    return false;
+}
+
+void encoder_accel_task(void) {
+    if (timer_elapsed(last_send) < ENCODER_ACCEL_REPORT_MS) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+        encoder_accel_state_t *state = &accel_state[i];
+        if (state->pending == 0) {
+            continue;
+        }
+
+        if (state->pending > 0) {
+            tap_code16(state->keycode_cw);
+            state->pending--;
+        } else {
+            tap_code16(state->keycode_ccw);
+            state->pending++;
+        }
+        last_send = timer_read();
+        return; // one step per report slot, shared by all encoders
+    }
+}
@@ -0,0 +1,71 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Shortest time between two steps sent to the host, each step is a press and a release report
+#ifndef ENCODER_ACCEL_REPORT_MS
+#    define ENCODER_ACCEL_REPORT_MS 10
+#endif
+
+// Waiting steps past which detents stop accelerating, so a fast spin doesn't trail on
+#ifndef ENCODER_ACCEL_MAX_PENDING
+#    define ENCODER_ACCEL_MAX_PENDING 16
+#endif
+
+/**
+ * Encoder acceleration for one layer.
+ *
+ * The time between detents is averaged, at `slow_ms` or slower a detent is
+ * one step, at `fast_ms` or faster it is `max_steps` steps, with a quadratic
+ * curve in between so slow turns stay precise.
+ *
+ * Every step reaches the host as a tap, a press and a release report of the
+ * keycode, paced ENCODER_ACCEL_REPORT_MS apart. This relies on the host
+ * polling the keyboard at least every ENCODER_ACCEL_REPORT_MS / 2 (QMK's
+ * default USB_POLLING_INTERVAL_MS is 1), so both reports of a tap are seen,
+ * and on the host taking each press as one step, which is how the volume
+ * and media usages work on Windows, macOS and Linux. A host that only reads
+ * the latest state on a slower poll would see fewer steps.
+ */
+typedef struct {
+    uint8_t slow_ms;
+    uint8_t fast_ms;
+    uint8_t max_steps; // 0 leaves the layer's encoder events alone
+} encoder_accel_t;
+
+#define ENCODER_ACCEL(slow_ms, fast_ms, max_steps) \
+    { slow_ms, fast_ms, max_steps }
+#define ENCODER_ACCEL_OFF ENCODER_ACCEL(0, 0, 0)
+
+/**
+ * @brief Acceleration for each layer and encoder.
+ *
+ * Defined in keymap.c next to the encoder map, the layer is the one the
+ * encoder keycode came from, so transparent layers use the layer below.
+ */
+extern const encoder_accel_t encoder_accel_map[][NUM_ENCODERS];
+extern const uint8_t         encoder_accel_map_count;
+
+/**
+ * @brief Takes the encoder map events of accelerated layers and counts their steps.
+ *
+ * Every detent adds its steps to the waiting ones, and steps in opposite
+ * directions cancel out. What is left is sent by encoder_accel_task(). Once
+ * ENCODER_ACCEL_MAX_PENDING steps wait, a detent only adds its own single
+ * step: the acceleration stops piling up a backlog, but no detent is ever
+ * dropped, so a faster spin never sends fewer steps than its detents. Call
+ * this first in `process_record_user`.
+ *
+ * @return False if the event was taken.
+ */
+bool process_encoder_accel(uint16_t keycode, keyrecord_t *record);
+
+/**
+ * @brief Sends waiting steps, one every ENCODER_ACCEL_REPORT_MS.
+ *
+ * Call this from `housekeeping_task_user`.
+ */
+void encoder_accel_task(void);
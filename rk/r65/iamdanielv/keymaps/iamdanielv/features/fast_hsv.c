@@ -0,0 +1,88 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "fast_hsv.h"
+#include "quantum.h"
+#include "rgb_matrix.h"
+#ifdef USE_CIE1931_CURVE
+#    include "led_tables.h"
+#endif
+
+// indexes into the component array built by fast_hsv_to_rgb
+enum { HSV_C_V, HSV_C_T, HSV_C_P, HSV_C_Q };
+
+// clang-format off
+/**
+ * @brief Which component goes to r, g and b for each of the hue sectors.
+ *
+ * Sector 6 only happens for h == 255 and is the same as sector 0.
+ */
+static const uint8_t hsv_sectors[7][3] = {
+    {HSV_C_V, HSV_C_T, HSV_C_P},
+    {HSV_C_Q, HSV_C_V, HSV_C_P},
+    {HSV_C_P, HSV_C_V, HSV_C_T},
+    {HSV_C_P, HSV_C_Q, HSV_C_V},
+    {HSV_C_T, HSV_C_P, HSV_C_V},
+    {HSV_C_V, HSV_C_P, HSV_C_Q},
+    {HSV_C_V, HSV_C_T, HSV_C_P},
+};
+// clang-format on
+
+/**
+ * @brief Converts an HSV color to RGB using a sector table.
+ *
+ * @param hsv The HSV color to convert.
+ * @return The RGB color.
+ */
+rgb_t fast_hsv_to_rgb(hsv_t hsv) {
+#ifdef USE_CIE1931_CURVE
+    const uint8_t v = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
+#else
+    const uint8_t v = hsv.v;
+#endif
+    const uint8_t s = hsv.s;
+
+    // (h * 193) >> 13 is the same as h * 6 / 255 for every 8 bit hue
+    const uint8_t sector    = ((uint16_t)hsv.h * 193) >> 13;
+    const uint8_t remainder = (uint8_t)((hsv.h * 2 - sector * 85) * 3);
+
+    uint8_t c[4];
+    c[HSV_C_V] = v;
+    c[HSV_C_P] = ((uint16_t)v * (uint8_t)(255 - s)) >> 8;
+    c[HSV_C_Q] = ((uint16_t)v * (uint8_t)(255 - (((uint16_t)s * remainder) >> 8))) >> 8;
+    c[HSV_C_T] = ((uint16_t)v * (uint8_t)(255 - (((uint16_t)s * (uint8_t)(255 - remainder)) >> 8))) >> 8;
+
+    if (s == 0) {
+        // no saturation is plain grey, the math above would round it down
+        c[HSV_C_P] = v;
+        c[HSV_C_Q] = v;
+        c[HSV_C_T] = v;
+    }
+
+    const uint8_t *route = hsv_sectors[sector];
+    return (rgb_t){.r = c[route[0]], .g = c[route[1]], .b = c[route[2]]};
+}
+
+/**
+ * @brief Converts a run of HSV colors straight into the RGB matrix buffer.
+ *
+ * @param hsv Array of `count` HSV colors.
+ * @param led_start The index of the first LED to write.
+ * @param count The number of LEDs to write.
+ */
+void fast_hsv_to_rgb_batch(const hsv_t *hsv, uint8_t led_start, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        const rgb_t rgb = fast_hsv_to_rgb(hsv[i]);
+        rgb_matrix_set_color(led_start + i, rgb.r, rgb.g, rgb.b);
+    }
+}
+
+/**
+ * @brief Replaces the weak RGB matrix conversion used by every effect.
+ *
+ * @param hsv The HSV color to convert.
+ * @return The RGB color.
+ */
+rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
+    return fast_hsv_to_rgb(hsv);
+}
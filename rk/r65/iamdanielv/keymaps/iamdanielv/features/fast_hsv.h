@@ -0,0 +1,31 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "color.h"
+
+/**
+ * @brief Converts an HSV color to RGB using a sector table.
+ *
+ * The hue sector is found with a multiply-shift instead of a divide and the
+ * (v, t, p, q) components are routed to (r, g, b) through a 7 entry table
+ * instead of a switch. The result is bit-exact with QMK's `hsv_to_rgb()`,
+ * including the CIE1931 curve when `USE_CIE1931_CURVE` is defined.
+ *
+ * @param hsv The HSV color to convert.
+ * @return The RGB color.
+ */
+rgb_t fast_hsv_to_rgb(hsv_t hsv);
+
+/**
+ * @brief Converts a run of HSV colors straight into the RGB matrix buffer.
+ *
+ * `hsv[0]` is written to LED `led_start`, `hsv[1]` to `led_start + 1` and so on.
+ *
+ * @param hsv Array of `count` HSV colors.
+ * @param led_start The index of the first LED to write.
+ * @param count The number of LEDs to write.
+ */
+void fast_hsv_to_rgb_batch(const hsv_t *hsv, uint8_t led_start, uint8_t count);
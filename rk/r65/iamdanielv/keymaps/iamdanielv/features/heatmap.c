@@ -0,0 +1,93 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "heatmap.h"
+#include "led_lookup.h"
+
+// 4 bits of heat per key, packed two keys to a byte (even index in the low nibble)
+static uint8_t heat_cells[(RGB_MATRIX_LED_COUNT + 1) / 2];
+// the decay tick when the heat of each key was last written
+static uint8_t heat_touched[RGB_MATRIX_LED_COUNT];
+
+// the time of the last heatmap_now() call, and the tick of the last pass over every key
+static uint32_t heat_last_call = 0;
+static uint8_t  heat_swept     = 0;
+
+#define HEAT_MAX 15
+
+// Ticks between passes that write back the cold keys, well under the 256 ticks of heat_touched
+#define HEAT_SWEEP_TICKS 64
+
+static inline uint8_t heat_get(uint8_t led_index) {
+    uint8_t cell = heat_cells[led_index >> 1];
+    return (led_index & 1) ? (cell >> 4) : (cell & 0x0F);
+}
+
+static inline void heat_set(uint8_t led_index, uint8_t heat) {
+    uint8_t *cell = &heat_cells[led_index >> 1];
+    if (led_index & 1) {
+        *cell = (*cell & 0x0F) | (heat << 4);
+    } else {
+        *cell = (*cell & 0xF0) | heat;
+    }
+}
+
+uint8_t heatmap_now(void) {
+    uint32_t ms  = timer_read32();
+    uint8_t  now = (uint8_t)(ms / HEATMAP_DECAY_MS);
+
+    // Keys are only touched with a tick from here. So after HEAT_MAX ticks
+    // without a call every key is cold, however long the effect was off.
+    if (ms - heat_last_call >= HEAT_MAX * HEATMAP_DECAY_MS) {
+        heatmap_clear();
+        heat_swept = now;
+    } else if ((uint8_t)(now - heat_swept) >= HEAT_SWEEP_TICKS) {
+        // keys the effect doesn't draw (LED flags) are never read, cool them here
+        // before their 8 bit tick can wrap back to looking fresh
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            heatmap_read(i, now);
+        }
+        heat_swept = now;
+    }
+    heat_last_call = ms;
+
+    return now;
+}
+
+uint8_t heatmap_read(uint8_t led_index, uint8_t now) {
+    uint8_t heat = heat_get(led_index);
+    if (!heat) {
+        return 0;
+    }
+
+    uint8_t cooled = now - heat_touched[led_index];
+    if (cooled >= heat) {
+        // write back the cold key, heatmap_now() reads every key well before its tick can wrap
+        heat_set(led_index, 0);
+        return 0;
+    }
+    return heat - cooled;
+}
+
+void heatmap_clear(void) {
+    memset(heat_cells, 0, sizeof(heat_cells));
+}
+
+void heatmap_record(keyrecord_t *record) {
+#if defined(PALETTEFX_ENABLE_ALL_EFFECTS) || defined(PALETTEFX_HEATMAP_ENABLE)
+    // encoder map events use rows past the matrix, they have no LED
+    if (!IS_KEYEVENT(record->event) || !record->event.pressed || rgb_matrix_get_mode() != RGB_MATRIX_CUSTOM_PALETTEFX_HEATMAP) {
+        return;
+    }
+
+    uint8_t led_index = led_matrix_to_led[record->event.key.row][record->event.key.col];
+    if (led_index == NO_LED) {
+        return;
+    }
+
+    uint8_t now  = heatmap_now();
+    uint8_t heat = heatmap_read(led_index, now) + HEATMAP_PRESS_HEAT;
+    heat_set(led_index, heat > HEAT_MAX ? HEAT_MAX : heat);
+    heat_touched[led_index] = now;
+#endif
+}
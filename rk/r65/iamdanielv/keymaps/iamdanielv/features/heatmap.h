@@ -0,0 +1,50 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// How long it takes for a key to cool down by one heat level
+#ifndef HEATMAP_DECAY_MS
+#    define HEATMAP_DECAY_MS 400
+#endif
+
+// How much heat a single key press adds, heat tops out at 15
+#ifndef HEATMAP_PRESS_HEAT
+#    define HEATMAP_PRESS_HEAT 4
+#endif
+
+/**
+ * @brief Adds heat to the key in `record` if the heatmap effect is running.
+ *
+ * @param record Pointer to the keyrecord_t structure containing key event details.
+ */
+void heatmap_record(keyrecord_t *record);
+
+/**
+ * @brief Returns the current decay tick, pass it to `heatmap_read`.
+ *
+ * The tick is 8 bits and wraps every 256 ticks. Every 64 ticks this reads
+ * every key once, so keys the effect skips are written back once cold, and
+ * after a break of 15 ticks or more (RGB off, suspended, another effect) the
+ * whole map is cleared.
+ */
+uint8_t heatmap_now(void);
+
+/**
+ * @brief Returns the heat of an LED (0 - 15), decayed up to `now`.
+ *
+ * Decay is worked out here from the time the key was last touched,
+ * so there is never a pass over the whole matrix.
+ *
+ * @param led_index The LED to read.
+ * @param now The tick returned by `heatmap_now`.
+ * @return The heat of the LED.
+ */
+uint8_t heatmap_read(uint8_t led_index, uint8_t now);
+
+/**
+ * @brief Cools down every key.
+ */
+void heatmap_clear(void);
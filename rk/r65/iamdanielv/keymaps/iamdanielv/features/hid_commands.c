@@ -0,0 +1,69 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "hid_commands.h"
+#include "quantum.h"
+#include "raw_hid.h"
+#include "user_palettes.h"
+#include "effect_bench.h"
+#include "host_stream.h"
+#include "indicator_queue.h"
+#include "key_color_map.h"
+
+/**
+ * @brief Runs a raw HID command in place.
+ *
+ * @param data The packet, the reply is written back into it.
+ * @param length The length of the packet.
+ * @return False if the command id is not one of ours.
+ */
+static bool hid_commands_process(uint8_t *data, uint8_t length) {
+    uint8_t status;
+
+    switch (data[0]) {
+        case HID_CMD_PALETTE_GET:
+        case HID_CMD_PALETTE_SET:
+        case HID_CMD_PALETTE_SAVE:
+            status = user_palettes_hid_command(data, length);
+            break;
+        case HID_CMD_BENCH_RUN:
+            status = effect_bench_hid_command(data, length);
+            break;
+        case HID_CMD_STREAM_FRAME:
+            status = host_stream_hid_command(data, length);
+            break;
+        case HID_CMD_INDICATORS:
+            status = indicator_queue_hid_command(data, length);
+            break;
+        case HID_CMD_KEY_COLORS_GET:
+        case HID_CMD_KEY_COLORS_SET:
+        case HID_CMD_KEY_COLORS_SAVE:
+            status = key_color_map_hid_command(data, length);
+            break;
+        default:
+            return false;
+    }
+
+    data[1] = status;
+    raw_hid_send(data, length);
+    return true;
+}
+
+#ifdef VIA_ENABLE
+/**
+ * @brief VIA hands us every packet first, anything we don't know goes on to VIA.
+ */
+bool via_command_kb(uint8_t *data, uint8_t length) {
+    return hid_commands_process(data, length);
+}
+#else
+/**
+ * @brief Without VIA we own the raw HID endpoint.
+ */
+void raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (!hid_commands_process(data, length)) {
+        data[1] = HID_STATUS_BAD_COMMAND;
+        raw_hid_send(data, length);
+    }
+}
+#endif
@@ -0,0 +1,40 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Raw HID commands
+ *
+ * Every packet starts with a command id. The ids start at 0x40 so they never
+ * collide with the VIA protocol, which lets the same commands work with VIA on or off.
+ *
+ * The reply is the same packet sent back with the status in byte 1:
+ *
+ *   request: [cmd] [args ...]
+ *   reply:   [cmd] [status] [data ...]
+ */
+enum hid_command_id {
+    HID_CMD_PALETTE_GET     = 0x40, // [slot] [first] [count]          -> [count] [HSV16 LE ...]
+    HID_CMD_PALETTE_SET     = 0x41, // [slot] [first] [count] [HSV16 LE ...]
+    HID_CMD_PALETTE_SAVE    = 0x42, // [slot]
+    HID_CMD_BENCH_RUN       = 0x43, // [mode] [speed] [frames]          -> see effect_bench.h
+    HID_CMD_STREAM_FRAME    = 0x44, // [first] [count] [flags] [R G B ...], see host_stream.h
+    HID_CMD_INDICATORS      = 0x45, // [count] [led interval flashes R G B] ..., see indicator_queue.h
+    HID_CMD_KEY_COLORS_GET  = 0x46, // [map] [offset] [count]      -> [count] [bytes ...]
+    HID_CMD_KEY_COLORS_SET  = 0x47, // [map] [offset] [count] [bytes ...]
+    HID_CMD_KEY_COLORS_SAVE = 0x48, // [map]
+};
+
+enum hid_command_status {
+    HID_STATUS_OK          = 0x00,
+    HID_STATUS_BAD_COMMAND = 0x01,
+    HID_STATUS_BAD_ARGS    = 0x02,
+    HID_STATUS_UNAVAILABLE = 0x03,
+};
+
+// Offset of the first argument in a request, and of the first data byte in a reply
+#define HID_CMD_ARGS 1
+#define HID_CMD_DATA 2
@@ -0,0 +1,60 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "hires_scroll.h"
+#include "pointing_device.h"
+
+// wheel movement waiting for a report, in 1 / HIRES_SCROLL_DETENT_DIV wheel counts
+static int32_t  pending_wheel = 0;
+static uint16_t last_detent   = 0;
+
+/**
+ * @brief Returns how many base amounts a detent is worth at this speed.
+ */
+static uint8_t hires_scroll_scale(uint16_t elapsed) {
+    if (elapsed >= HIRES_SCROLL_SLOW_MS) {
+        return 1;
+    }
+    if (elapsed <= HIRES_SCROLL_FAST_MS) {
+        return HIRES_SCROLL_MAX_SCALE;
+    }
+    return 1 + ((HIRES_SCROLL_MAX_SCALE - 1) * (HIRES_SCROLL_SLOW_MS - elapsed)) / (HIRES_SCROLL_SLOW_MS - HIRES_SCROLL_FAST_MS);
+}
+
+void hires_scroll_detent(bool up) {
+    uint16_t elapsed = timer_elapsed(last_detent);
+    last_detent      = timer_read();
+
+    int32_t amount = (int32_t)pointing_device_get_hires_scroll_resolution() * hires_scroll_scale(elapsed);
+
+    // turning back drops what the old direction still had queued
+    if ((up && pending_wheel < 0) || (!up && pending_wheel > 0)) {
+        pending_wheel = 0;
+    }
+    pending_wheel += up ? amount : -amount;
+}
+
+bool pointing_device_driver_init(void) {
+    return true;
+}
+
+report_mouse_t pointing_device_driver_get_report(report_mouse_t mouse_report) {
+    int32_t counts = pending_wheel / HIRES_SCROLL_DETENT_DIV;
+    if (counts > 127) {
+        counts = 127;
+    } else if (counts < -127) {
+        counts = -127;
+    }
+
+    mouse_report.v = counts;
+    pending_wheel -= counts * HIRES_SCROLL_DETENT_DIV;
+    return mouse_report;
+}
+
+uint16_t pointing_device_driver_get_cpi(void) {
+    return 0;
+}
+
+void pointing_device_driver_set_cpi(uint16_t cpi) {
+    (void)cpi;
+}
@@ -0,0 +1,45 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Share of a classic wheel notch one slow detent scrolls, 4 means a quarter notch
+#ifndef HIRES_SCROLL_DETENT_DIV
+#    define HIRES_SCROLL_DETENT_DIV 4
+#endif
+
+// Detents closer together than this scroll HIRES_SCROLL_MAX_SCALE times as far
+#ifndef HIRES_SCROLL_FAST_MS
+#    define HIRES_SCROLL_FAST_MS 15
+#endif
+
+// Detents this far apart or more scroll the base amount
+#ifndef HIRES_SCROLL_SLOW_MS
+#    define HIRES_SCROLL_SLOW_MS 100
+#endif
+
+#ifndef HIRES_SCROLL_MAX_SCALE
+#    define HIRES_SCROLL_MAX_SCALE 6
+#endif
+
+/**
+ * Scroll wheel on the encoder, using the high resolution wheel report.
+ *
+ * The pointing device uses the custom driver, it has no sensor and only
+ * reports the wheel movement queued here. When the host turns on the
+ * resolution multiplier (POINTING_DEVICE_HIRES_SCROLL_ENABLE in config.h),
+ * a wheel count is 1 / multiplier of a notch, so a detent scrolls a fraction
+ * of a line. Hosts without it get whole notches once the fractions add up.
+ * Faster turns scale each detent up to HIRES_SCROLL_MAX_SCALE times.
+ *
+ * Bound per layer through keycodes in encoder_map, see keymap.c.
+ */
+
+/**
+ * @brief Queues the wheel movement for one encoder detent.
+ *
+ * @param up True to scroll up.
+ */
+void hires_scroll_detent(bool up);
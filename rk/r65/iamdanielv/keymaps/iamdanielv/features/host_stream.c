@@ -0,0 +1,74 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "host_stream.h"
+#include "hid_commands.h"
+#include "rgb_governor.h"
+
+static rgb_t   stream_frames[2][RGB_MATRIX_LED_COUNT];
+static uint8_t front = 0;
+
+// LEDs written into the back buffer since the last swap, bit i of word i / 32
+#define DIRTY_WORDS ((RGB_MATRIX_LED_COUNT + 31) / 32)
+static uint32_t dirty[DIRTY_WORDS];
+
+static bool     streaming       = false;
+static uint8_t  previous_mode   = 0;
+static uint32_t last_frame_time = 0;
+
+const rgb_t *host_stream_frame(void) {
+    return stream_frames[front];
+}
+
+uint8_t host_stream_hid_command(uint8_t *data, uint8_t length) {
+    uint8_t *args  = &data[HID_CMD_ARGS];
+    uint8_t  first = args[0];
+    uint8_t  count = args[1];
+    uint8_t  flags = args[2];
+
+    if (first >= RGB_MATRIX_LED_COUNT || count > RGB_MATRIX_LED_COUNT - first || HID_CMD_ARGS + 3 + 3 * count > length) {
+        return HID_STATUS_BAD_ARGS;
+    }
+
+    // the packet goes straight into the back buffer, rgb_t is packed as R G B
+    memcpy(&stream_frames[front ^ 1][first], &args[3], 3 * count);
+    for (uint8_t i = first; i < first + count; i++) {
+        dirty[i >> 5] |= 1UL << (i & 31);
+    }
+
+    if (flags & HOST_STREAM_FLAG_END) {
+        front ^= 1;
+        last_frame_time = timer_read32();
+
+        // The new back buffer holds the frame before this one. Bring over the
+        // LEDs this frame changed, so the next frame only needs the LEDs that
+        // change again. That's the chunks the host just sent, never the whole frame.
+        for (uint8_t word = 0; word < DIRTY_WORDS; word++) {
+            while (dirty[word]) {
+                uint8_t i = word * 32 + __builtin_ctzl(dirty[word]);
+                dirty[word] &= dirty[word] - 1;
+                stream_frames[front ^ 1][i] = stream_frames[front][i];
+            }
+        }
+
+        if (!streaming) {
+            streaming     = true;
+            previous_mode = rgb_matrix_get_mode();
+            rgb_matrix_mode_noeeprom(RGB_MATRIX_CUSTOM_HOST_STREAM);
+        }
+        rgb_governor_kick();
+    }
+    return HID_STATUS_OK;
+}
+
+void host_stream_task(void) {
+    if (!streaming || timer_elapsed32(last_frame_time) < HOST_STREAM_TIMEOUT_MS) {
+        return;
+    }
+
+    streaming = false;
+    // the user may have picked another effect in the meantime, leave it alone
+    if (rgb_matrix_get_mode() == RGB_MATRIX_CUSTOM_HOST_STREAM) {
+        rgb_matrix_mode_noeeprom(previous_mode);
+    }
+}
@@ -0,0 +1,52 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Go back to the previous effect when no frame arrived for this long
+#ifndef HOST_STREAM_TIMEOUT_MS
+#    define HOST_STREAM_TIMEOUT_MS 2000
+#endif
+
+// HID_CMD_STREAM_FRAME flags
+#define HOST_STREAM_FLAG_END 0x01 // last chunk, show the frame
+
+/**
+ * Host frame streaming
+ *
+ * The host sends frames in chunks with HID_CMD_STREAM_FRAME:
+ *
+ *   request: [first LED] [count] [flags] [R G B ...]
+ *
+ * A 32 byte packet carries up to 9 LEDs, so a frame of 66 LEDs takes 8 packets.
+ * Chunks are written straight into the back buffer, and the chunk flagged
+ * HOST_STREAM_FLAG_END swaps it with the front buffer that the HOST_STREAM
+ * effect draws. Only the LEDs written in that frame are then copied into the
+ * new back buffer, so a frame only needs the chunks for the LEDs that changed
+ * since the last one, and a swap costs no more than the chunks it got.
+ *
+ * The first frame switches to that effect, and the previous effect comes back
+ * once frames stop for HOST_STREAM_TIMEOUT_MS. tools/host_stream.py is a
+ * Linux client.
+ */
+
+/**
+ * @brief Returns the frame the HOST_STREAM effect should draw.
+ */
+const rgb_t *host_stream_frame(void);
+
+/**
+ * @brief Handles the HID_CMD_STREAM_FRAME raw HID command.
+ *
+ * @param data The packet.
+ * @param length The length of the packet.
+ * @return One of `hid_command_status`.
+ */
+uint8_t host_stream_hid_command(uint8_t *data, uint8_t length);
+
+/**
+ * @brief Restores the previous effect once the host stops streaming, call from housekeeping.
+ */
+void host_stream_task(void);
@@ -1,5 +1,6 @@
 #include "indicator_queue.h"
 #include "indicators.h"
+#include "hid_commands.h"
 
 #define TIMER_DEFAULT_VALUE 0x00
 
@@ -81,3 +82,40 @@ void process_indicator_queue(uint8_t led_min, uint8_t led_max) {
         }
     }
 }
+
+/**
+ * @brief Handles the HID_CMD_INDICATORS raw HID command.
+ *
+ * @param data The packet.
+ * @param length The length of the packet.
+ * @return One of `hid_command_status`.
+ */
+uint8_t indicator_queue_hid_command(uint8_t *data, uint8_t length) {
+    uint8_t *args  = &data[HID_CMD_ARGS];
+    uint8_t  count = args[0];
+    if (count == 0 || HID_CMD_ARGS + 1 + count * INDICATOR_HID_ENTRY_SIZE > length) {
+        return HID_STATUS_BAD_ARGS;
+    }
+
+    // check the whole batch first so a bad entry doesn't leave it half applied
+    const uint8_t *entry = &args[1];
+    for (uint8_t i = 0; i < count; i++, entry += INDICATOR_HID_ENTRY_SIZE) {
+        if (entry[0] >= RGB_MATRIX_LED_COUNT) {
+            return HID_STATUS_BAD_ARGS;
+        }
+        // a flash needs time between its steps, and the doubled count has to fit times_to_flash
+        if (entry[2] != 0 && (entry[1] == 0 || entry[2] > INDICATOR_HID_MAX_FLASHES)) {
+            return HID_STATUS_BAD_ARGS;
+        }
+    }
+
+    entry = &args[1];
+    for (uint8_t i = 0; i < count; i++, entry += INDICATOR_HID_ENTRY_SIZE) {
+        if (entry[2] == 0) {
+            indicator_dequeue(entry[0]);
+        } else {
+            indicator_enqueue(entry[0], entry[1] * INDICATOR_HID_INTERVAL_UNIT, entry[2], entry[3], entry[4], entry[5]);
+        }
+    }
+    return HID_STATUS_OK;
+}
@@ -79,3 +79,26 @@ void process_indicator_queue(uint8_t led_min, uint8_t led_max);
  * @param led_index Index of the LED to dequeue.
  */
 void indicator_dequeue(uint8_t led_index);
+
+// Host indicator commands, see indicator_queue_hid_command
+#define INDICATOR_HID_ENTRY_SIZE 6
+#define INDICATOR_HID_INTERVAL_UNIT 10 // ms per interval step
+#define INDICATOR_HID_MAX_FLASHES 127  // times_to_flash holds twice this
+
+/**
+ * @brief Handles the HID_CMD_INDICATORS raw HID command, a batch of queue operations.
+ *
+ * request: [count] then `count` entries of [led_index] [interval] [flashes] [r] [g] [b]
+ *
+ * The interval is in steps of INDICATOR_HID_INTERVAL_UNIT ms. An entry with
+ * 0 flashes dequeues the LED instead. A flashing entry needs an interval of
+ * at least 1 and at most INDICATOR_HID_MAX_FLASHES flashes, or the whole
+ * batch is refused with HID_STATUS_BAD_ARGS. tools/indicators.py encodes
+ * the batches on the host. Only as many entries as fit in one
+ * packet are accepted, so a packet costs at most 5 passes over the queue.
+ *
+ * @param data The packet.
+ * @param length The length of the packet.
+ * @return One of `hid_command_status`.
+ */
+uint8_t indicator_queue_hid_command(uint8_t *data, uint8_t length);
@@ -3,6 +3,9 @@
 #include "dv_layer_lock.h"
 #include "indicator_queue.h"
 #include "fn_mode.h"
+#include "fast_hsv.h"
+#include "led_budget.h"
+#include "rgb_pipeline.h"
 #include "color.h"
 #include "quantum.h"
 #include "rgb_matrix.h"
@@ -213,6 +216,9 @@ void set_layer_color_indicator(uint8_t layer, uint8_t led_index, rgb_t color, ui
  * @return True if the pipeline should continue processing, false if processing should stop.
  */
 bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max) {
+    led_budget_indicators_start();
+    rgb_pipeline_overlay(true);
+
     // check for caps lock
     if (host_keyboard_led_state().caps_lock) {
         // we can use the LED Indicator for CAPS_LOCK as well
@@ -245,10 +251,10 @@ bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max) {
         hsv_t base_hsv_inverse_shifted = get_hsv_color_shifted(base_hsv_inverse, HUE_ACCENT, false);
 
         // recalculate the colors
-        ext_lyr_rgb    = hsv_to_rgb(base_hsv_offset);
-        accent_lyr_rgb = hsv_to_rgb(base_hsv_inverse_shifted);
-        num_lyr_rgb    = hsv_to_rgb(base_hsv_offset_qrt_cw);
-        dual_role_rgb  = hsv_to_rgb(base_hsv_inverse);
+        ext_lyr_rgb    = fast_hsv_to_rgb(base_hsv_offset);
+        accent_lyr_rgb = fast_hsv_to_rgb(base_hsv_inverse_shifted);
+        num_lyr_rgb    = fast_hsv_to_rgb(base_hsv_offset_qrt_cw);
+        dual_role_rgb  = fast_hsv_to_rgb(base_hsv_inverse);
 
         recalculate_rgb = false;
     }
@@ -370,5 +376,7 @@ bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max) {
 
     process_indicator_queue(led_min, led_max);
 
+    rgb_pipeline_overlay(false);
+    led_budget_indicators_end(led_min, led_max);
     return true;
 }
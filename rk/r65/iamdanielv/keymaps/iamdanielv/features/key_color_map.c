@@ -0,0 +1,79 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "key_color_map.h"
+#include "hid_commands.h"
+#include "rgb_governor.h"
+
+_Static_assert(sizeof(key_color_map_t) == 81, "key_color_map_t changed size, update EECONFIG_USER_DATA_SIZE in config.h");
+_Static_assert(KEY_COLOR_MAP_OFFSET + sizeof(key_color_map_store_t) <= EECONFIG_USER_DATA_SIZE, "EECONFIG_USER_DATA_SIZE is too small for the key color maps");
+
+key_color_map_t key_color_maps[KEY_COLOR_MAP_COUNT];
+
+// true once the EEPROM holds a full set of maps
+static bool maps_stored = false;
+
+// starting palette for maps that were never saved, every key uses color 1
+static const uint8_t default_colors[16][3] PROGMEM = {
+    {RGB_BLACK},  {RGB_WHITE},  {RGB_RED},    {RGB_ORANGE}, {RGB_YELLOW},    {RGB_CHARTREUSE}, {RGB_GREEN}, {RGB_SPRINGGREEN},
+    {RGB_CYAN},   {RGB_AZURE},  {RGB_BLUE},   {RGB_PURPLE}, {RGB_MAGENTA},   {RGB_PINK},       {RGB_CORAL}, {RGB_GOLD},
+};
+
+#define MAP_OFFSET(slot) (KEY_COLOR_MAP_OFFSET + offsetof(key_color_map_store_t, maps) + (slot) * sizeof(key_color_map_t))
+
+void key_color_map_init(void) {
+    uint16_t magic = 0;
+    eeconfig_read_user_datablock(&magic, KEY_COLOR_MAP_OFFSET + offsetof(key_color_map_store_t, magic), sizeof(magic));
+
+    maps_stored = (magic == KEY_COLOR_MAP_MAGIC);
+    if (maps_stored) {
+        eeconfig_read_user_datablock(key_color_maps, MAP_OFFSET(0), sizeof(key_color_maps));
+        return;
+    }
+
+    for (uint8_t slot = 0; slot < KEY_COLOR_MAP_COUNT; slot++) {
+        memcpy_P(key_color_maps[slot].colors, default_colors, sizeof(default_colors));
+        memset(key_color_maps[slot].keys, 0x11, sizeof(key_color_maps[slot].keys));
+    }
+}
+
+uint8_t key_color_map_hid_command(uint8_t *data, uint8_t length) {
+    uint8_t *args = &data[HID_CMD_ARGS];
+    uint8_t  slot = args[0];
+    if (slot >= KEY_COLOR_MAP_COUNT) {
+        return HID_STATUS_BAD_ARGS;
+    }
+
+    if (data[0] == HID_CMD_KEY_COLORS_SAVE) {
+        if (maps_stored) {
+            eeconfig_update_user_datablock(&key_color_maps[slot], MAP_OFFSET(slot), sizeof(key_color_map_t));
+        } else {
+            // first save, write every map so the others don't load back as garbage
+            uint16_t magic = KEY_COLOR_MAP_MAGIC;
+            eeconfig_update_user_datablock(key_color_maps, MAP_OFFSET(0), sizeof(key_color_maps));
+            eeconfig_update_user_datablock(&magic, KEY_COLOR_MAP_OFFSET + offsetof(key_color_map_store_t, magic), sizeof(magic));
+            maps_stored = true;
+        }
+        return HID_STATUS_OK;
+    }
+
+    uint8_t offset = args[1];
+    uint8_t count  = args[2];
+    // SET needs 4 header bytes plus the data, GET replies with 3 plus the data
+    if (offset >= sizeof(key_color_map_t) || count > sizeof(key_color_map_t) - offset || 4 + count > length) {
+        return HID_STATUS_BAD_ARGS;
+    }
+
+    uint8_t *map = (uint8_t *)&key_color_maps[slot];
+    if (data[0] == HID_CMD_KEY_COLORS_SET) {
+        memcpy(&map[offset], &args[3], count);
+        rgb_governor_kick();
+        return HID_STATUS_OK;
+    }
+
+    // HID_CMD_KEY_COLORS_GET
+    uint8_t *reply = &data[HID_CMD_DATA];
+    reply[0]       = count;
+    memcpy(&reply[1], &map[offset], count);
+    return HID_STATUS_OK;
+}
@@ -0,0 +1,71 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+#include "user_palettes.h"
+
+// One map per layer, layers past the last map use the last one
+#ifndef KEY_COLOR_MAP_COUNT
+#    define KEY_COLOR_MAP_COUNT 6
+#endif
+
+// Bumped whenever the layout of the stored maps changes
+#define KEY_COLOR_MAP_MAGIC 0x4B43
+
+/**
+ * @brief A per-key color map: a 16 color palette and a 4 bit palette index per LED.
+ *
+ * LED i uses the low nibble of keys[i / 2] when i is even and the high nibble when odd.
+ * At 81 bytes a map is about a third of a plain RGB map.
+ */
+typedef struct {
+    uint8_t colors[16][3]; // R G B
+    uint8_t keys[(RGB_MATRIX_LED_COUNT + 1) / 2];
+} key_color_map_t;
+
+/**
+ * @brief How the maps are laid out in the EEPROM user datablock, right after the user palettes.
+ */
+typedef struct {
+    uint16_t        magic;
+    key_color_map_t maps[KEY_COLOR_MAP_COUNT];
+} key_color_map_store_t;
+
+#define KEY_COLOR_MAP_OFFSET sizeof(user_palettes_store_t)
+
+/**
+ * @brief The RAM copy of the maps, the KEY_COLOR_MAP effect reads from it.
+ */
+extern key_color_map_t key_color_maps[KEY_COLOR_MAP_COUNT];
+
+/**
+ * @brief Returns the palette index (0 - 15) of an LED in a map.
+ */
+static inline uint8_t key_color_map_index(const key_color_map_t *map, uint8_t led_index) {
+    uint8_t pair = map->keys[led_index >> 1];
+    return (led_index & 1) ? (pair >> 4) : (pair & 0x0F);
+}
+
+/**
+ * @brief Loads the maps from EEPROM into RAM, call from `keyboard_post_init_user`.
+ */
+void key_color_map_init(void);
+
+/**
+ * @brief Handles the HID_CMD_KEY_COLORS_* raw HID commands.
+ *
+ * GET and SET address the bytes of one key_color_map_t:
+ *
+ *   GET:  [map] [offset] [count]              -> [count] [bytes ...]
+ *   SET:  [map] [offset] [count] [bytes ...]
+ *   SAVE: [map]
+ *
+ * SET only changes the RAM copy so the map can be previewed live, SAVE writes it to EEPROM.
+ *
+ * @param data The packet, the reply data is written back into it.
+ * @param length The length of the packet.
+ * @return One of `hid_command_status`.
+ */
+uint8_t key_color_map_hid_command(uint8_t *data, uint8_t length);
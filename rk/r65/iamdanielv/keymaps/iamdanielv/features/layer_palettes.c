@@ -0,0 +1,29 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "layer_palettes.h"
+#include "rgb_pipeline.h"
+
+/**
+ * @brief Looks up the palette for the highest active layer and crossfades to it.
+ *
+ * @param state The new layer state bitmask.
+ */
+void layer_palettes_update(layer_state_t state) {
+    static uint8_t current_palette = LAYER_PALETTE_NONE;
+
+    uint8_t layer   = get_highest_layer(state);
+    uint8_t palette = LAYER_PALETTE_NONE;
+    if (layer < layer_palettes_count) {
+        palette = pgm_read_byte(&layer_palettes[layer]);
+    }
+
+    if (palette == current_palette) {
+        // same palette, nothing to blend
+        return;
+    }
+
+    rgb_pipeline_crossfade_start();
+    palettefx_set_palette_override(palette);
+    current_palette = palette;
+}
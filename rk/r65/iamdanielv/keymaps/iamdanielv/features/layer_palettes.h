@@ -0,0 +1,29 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+#include "palettefx.h"
+
+/**
+ * @brief Used in `layer_palettes` for layers that follow the hue setting.
+ */
+#define LAYER_PALETTE_NONE PALETTEFX_NO_OVERRIDE
+
+/**
+ * @brief PaletteFx palette to use while a layer is the highest active layer.
+ *
+ * Defined in keymap.c next to the encoder map, one entry per layer.
+ */
+extern const uint8_t layer_palettes[];
+extern const uint8_t layer_palettes_count;
+
+/**
+ * @brief Looks up the palette for the highest active layer and crossfades to it.
+ *
+ * Call this from `layer_state_set_user`.
+ *
+ * @param state The new layer state bitmask.
+ */
+void layer_palettes_update(layer_state_t state);
@@ -0,0 +1,72 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "led_budget.h"
+#include "quantum.h"
+#include "cycles.h"
+#include "rgb_pipeline.h"
+
+// QMK's default, used until the current effect has been measured
+#define LED_BUDGET_DEFAULT_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
+
+#define LED_BUDGET_CYCLES (LED_BUDGET_US * CYCLES_PER_US)
+
+uint8_t led_budget_extra = LED_BUDGET_DEFAULT_LIMIT - 1;
+
+// running averages, 0 means not measured yet
+static uint32_t per_led_cycles    = 0;
+static uint32_t indicators_cycles = 0;
+
+static uint8_t  measured_mode    = 0;
+static uint32_t indicators_start = 0;
+
+static inline uint32_t average(uint32_t avg, uint32_t sample) {
+    return avg ? (3 * avg + sample) / 4 : sample;
+}
+
+void led_budget_indicators_start(void) {
+    indicators_start = cycles_read();
+
+    // everything written so far in this iteration came from the effect
+    rgb_pipeline_writes_t writes;
+    rgb_pipeline_take_writes(&writes);
+    if (writes.count >= 2) {
+        per_led_cycles = average(per_led_cycles, (writes.last - writes.first) / (writes.count - 1));
+    }
+}
+
+void led_budget_indicators_end(uint8_t led_min, uint8_t led_max) {
+    indicators_cycles = average(indicators_cycles, cycles_read() - indicators_start);
+
+    // drop the indicator writes so they don't count towards the effect
+    rgb_pipeline_writes_t writes;
+    rgb_pipeline_take_writes(&writes);
+
+    if (led_max < RGB_MATRIX_LED_COUNT) {
+        return; // only retune between frames
+    }
+
+    uint8_t mode = rgb_matrix_get_mode();
+    if (mode != measured_mode) {
+        // a new effect, measure it from scratch
+        measured_mode     = mode;
+        per_led_cycles    = 0;
+        indicators_cycles = 0;
+        led_budget_extra  = LED_BUDGET_DEFAULT_LIMIT - 1;
+        return;
+    }
+    if (!per_led_cycles) {
+        return;
+    }
+
+    uint32_t limit = 1;
+    if (indicators_cycles < LED_BUDGET_CYCLES) {
+        limit = (LED_BUDGET_CYCLES - indicators_cycles) / per_led_cycles;
+    }
+    if (limit < 1) {
+        limit = 1;
+    } else if (limit > RGB_MATRIX_LED_COUNT) {
+        limit = RGB_MATRIX_LED_COUNT;
+    }
+    led_budget_extra = limit - 1;
+}
@@ -0,0 +1,42 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+// Time one RGB matrix iteration (effect + indicators) should take
+#ifndef LED_BUDGET_US
+#    define LED_BUDGET_US 200
+#endif
+
+/**
+ * Self-tuning LED processing budget
+ *
+ * The RGB matrix renders RGB_MATRIX_LED_PROCESS_LIMIT LEDs per call to
+ * rgb_matrix_task(). config.h points that limit at `1 + led_budget_extra`,
+ * which is tuned here so each iteration fits in LED_BUDGET_US.
+ *
+ * The effect cost per LED comes from the spacing of its set_color calls (see
+ * rgb_pipeline_take_writes) and the indicators are timed directly. The limit
+ * only changes at the end of a frame, so a frame never mixes two limits,
+ * and it starts over from the stock limit whenever the effect changes.
+ */
+
+/**
+ * @brief LEDs per iteration minus one, see RGB_MATRIX_LED_PROCESS_LIMIT in config.h.
+ */
+extern uint8_t led_budget_extra;
+
+/**
+ * @brief Call at the start of rgb_matrix_indicators_advanced_user, once the effect is done.
+ */
+void led_budget_indicators_start(void);
+
+/**
+ * @brief Call at the end of rgb_matrix_indicators_advanced_user.
+ *
+ * @param led_min The first LED of this iteration.
+ * @param led_max One past the last LED of this iteration.
+ */
+void led_budget_indicators_end(uint8_t led_min, uint8_t led_max);
@@ -0,0 +1,24 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "led_lookup.h"
+#include "defines.h"
+
+// the generated tables must describe this keyboard
+_Static_assert(LED_TABLES_LED_COUNT == RGB_MATRIX_LED_COUNT, "led_index_tables.h: LED count does not match RGB_MATRIX_LED_COUNT");
+_Static_assert(LED_TABLES_ROWS == MATRIX_ROWS, "led_index_tables.h: row count does not match MATRIX_ROWS");
+_Static_assert(LED_TABLES_COLS == MATRIX_COLS, "led_index_tables.h: column count does not match MATRIX_COLS");
+_Static_assert(LED_TABLES_MASK_WORDS * 32 >= RGB_MATRIX_LED_COUNT, "led_index_tables.h: masks are too small for every LED");
+_Static_assert(NO_LED == 255, "led_index_tables.h: uses 255 for keys without an LED");
+
+// keys the indicators rely on, a missing or mistyped label fails here instead of lighting the wrong key
+_Static_assert(CAPS_KI < RGB_MATRIX_LED_COUNT && LEFT_WIN_KI < RGB_MATRIX_LED_COUNT && LEFT_SFT_KI < RGB_MATRIX_LED_COUNT, "led_index_tables.h: modifier LEDs out of range");
+_Static_assert(FN1_KI == N1_KI && FN12_KI == EQL_KI, "defines.h: F key aliases no longer match the number row");
+
+const uint8_t led_matrix_to_led[LED_TABLES_ROWS][LED_TABLES_COLS] = LED_TABLES_MATRIX_TO_LED;
+
+const uint8_t led_to_matrix[LED_TABLES_LED_COUNT] = LED_TABLES_LED_TO_MATRIX;
+
+const uint32_t led_row_masks[LED_TABLES_ROWS][LED_TABLES_MASK_WORDS] = LED_TABLES_ROW_MASKS;
+
+const uint32_t led_col_masks[LED_TABLES_COLS][LED_TABLES_MASK_WORDS] = LED_TABLES_COL_MASKS;
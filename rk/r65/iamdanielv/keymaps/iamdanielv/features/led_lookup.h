@@ -0,0 +1,35 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+#include "led_index_tables.h"
+
+/**
+ * LED lookups generated from keyboard.json (see tools/gen_led_tables.py),
+ * so nothing has to search g_led_config at runtime.
+ */
+
+/**
+ * @brief [row][col] -> LED index, NO_LED where a key has no LED.
+ */
+extern const uint8_t led_matrix_to_led[LED_TABLES_ROWS][LED_TABLES_COLS];
+
+/**
+ * @brief LED index -> row << 4 | col, 0xFF for LEDs without a key.
+ */
+extern const uint8_t led_to_matrix[LED_TABLES_LED_COUNT];
+
+/**
+ * @brief The LEDs on each matrix row and column, see led_mask_has().
+ */
+extern const uint32_t led_row_masks[LED_TABLES_ROWS][LED_TABLES_MASK_WORDS];
+extern const uint32_t led_col_masks[LED_TABLES_COLS][LED_TABLES_MASK_WORDS];
+
+/**
+ * @brief Returns true if `led_index` is in `mask`, a row or column of led_row_masks / led_col_masks.
+ */
+static inline bool led_mask_has(const uint32_t *mask, uint8_t led_index) {
+    return mask[led_index >> 5] & (1UL << (led_index & 31));
+}
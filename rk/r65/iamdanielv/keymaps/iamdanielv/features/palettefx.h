@@ -47,6 +47,17 @@ const uint16_t* palettefx_get_palette_data_by_index(uint8_t i);
 /** Returns the number of palettes. */
 uint8_t palettefx_num_palettes(void);
 
+/** Passed to palettefx_set_palette_override() to follow the hue setting again. */
+#define PALETTEFX_NO_OVERRIDE 0xff
+
+/**
+ * Forces the ith palette to be used regardless of the hue setting, for
+ * instance to give a layer its own palette. Pass PALETTEFX_NO_OVERRIDE to go
+ * back to selecting the palette with the hue, an index past the last palette
+ * does the same.
+ */
+void palettefx_set_palette_override(uint8_t i);
+
 /**
  * @brief Computes the interpolated HSV palette color at 0 <= x < 256.
  *
@@ -0,0 +1,108 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_governor.h"
+#include "quantum.h"
+#include "indicator_queue.h"
+#include "rgb_pipeline.h"
+
+// everything a static scene depends on, a change forces a redraw
+typedef struct {
+    rgb_config_t  config;
+    layer_state_t layers;
+    uint32_t      last_input;
+    uint8_t       host_leds;
+} governor_state_t;
+
+static governor_state_t last_state;
+
+// frames keep being drawn at the full rate until this frame count is reached
+static uint32_t kick_until_frame = 0;
+
+/**
+ * @brief Returns the class declared with RGB_MATRIX_EFFECT_CLASS for our custom effects.
+ */
+static uint8_t custom_effect_class(uint8_t mode) {
+#undef RGB_MATRIX_EFFECT
+#define RGB_MATRIX_EFFECT(name, ...)
+// rgb_matrix_user.inc already left its empty fallback behind when rgb_matrix.h pulled it in
+#undef RGB_MATRIX_EFFECT_CLASS
+#define RGB_MATRIX_EFFECT_CLASS(name, effect_class) \
+    case RGB_MATRIX_CUSTOM_##name:                  \
+        return effect_class;
+
+    switch (mode) {
+#include "rgb_matrix_user.inc"
+        default:
+            return RGB_EFFECT_FAST;
+    }
+
+#undef RGB_MATRIX_EFFECT
+#undef RGB_MATRIX_EFFECT_CLASS
+}
+
+/**
+ * @brief Returns the class of an effect, built-in effects are listed here.
+ */
+static uint8_t effect_class(uint8_t mode) {
+    switch (mode) {
+        case RGB_MATRIX_NONE:
+        case RGB_MATRIX_SOLID_COLOR:
+#ifdef ENABLE_RGB_MATRIX_GRADIENT_UP_DOWN
+        case RGB_MATRIX_GRADIENT_UP_DOWN:
+#endif
+            return RGB_EFFECT_STATIC;
+#ifdef ENABLE_RGB_MATRIX_BREATHING
+        case RGB_MATRIX_BREATHING:
+#endif
+#ifdef ENABLE_RGB_MATRIX_HUE_BREATHING
+        case RGB_MATRIX_HUE_BREATHING:
+#endif
+#ifdef ENABLE_RGB_MATRIX_HUE_PENDULUM
+        case RGB_MATRIX_HUE_PENDULUM:
+#endif
+            return RGB_EFFECT_SLOW;
+        default:
+            return custom_effect_class(mode);
+    }
+}
+
+static bool indicators_blinking(void) {
+    for (uint8_t i = 0; i < INDICATOR_QUEUE_MAX; i++) {
+        if (indicator_queue[i].active) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void rgb_governor_kick(void) {
+    // the frame in progress may still have the old state, so draw two
+    kick_until_frame = rgb_pipeline_frame_count() + 2;
+}
+
+uint32_t rgb_governor_flush_limit(void) {
+    governor_state_t state;
+    memset(&state, 0, sizeof(state)); // padding too, for the memcmp
+    state.config     = rgb_matrix_config;
+    state.layers     = layer_state | default_layer_state;
+    state.last_input = last_input_activity_time();
+    state.host_leds  = host_keyboard_led_state().raw;
+    if (memcmp(&state, &last_state, sizeof(state)) != 0) {
+        last_state = state;
+        rgb_governor_kick();
+    }
+
+    if ((int32_t)(kick_until_frame - rgb_pipeline_frame_count()) > 0 || indicators_blinking() || rgb_pipeline_crossfade_active()) {
+        return RGB_GOVERNOR_FAST_MS;
+    }
+
+    switch (effect_class(rgb_matrix_config.mode)) {
+        case RGB_EFFECT_STATIC:
+            return RGB_GOVERNOR_STATIC_MS;
+        case RGB_EFFECT_SLOW:
+            return RGB_GOVERNOR_SLOW_MS;
+        default:
+            return last_input_activity_elapsed() < RGB_GOVERNOR_IDLE_TIMEOUT_MS ? RGB_GOVERNOR_FAST_MS : RGB_GOVERNOR_SLOW_MS;
+    }
+}
@@ -0,0 +1,57 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+// Frame interval while animating at full rate, the stock QMK rate
+#ifndef RGB_GOVERNOR_FAST_MS
+#    define RGB_GOVERNOR_FAST_MS 16
+#endif
+
+// Frame interval for slow effects, and for any effect once the keyboard is idle
+#ifndef RGB_GOVERNOR_SLOW_MS
+#    define RGB_GOVERNOR_SLOW_MS 40
+#endif
+
+// No input for this long counts as idle
+#ifndef RGB_GOVERNOR_IDLE_TIMEOUT_MS
+#    define RGB_GOVERNOR_IDLE_TIMEOUT_MS 5000
+#endif
+
+// Static scenes are still redrawn this often to catch state we don't track
+#ifndef RGB_GOVERNOR_STATIC_MS
+#    define RGB_GOVERNOR_STATIC_MS 500
+#endif
+
+/**
+ * RGB frame-rate governor
+ *
+ * config.h points RGB_MATRIX_LED_FLUSH_LIMIT at rgb_governor_flush_limit(), so
+ * the RGB matrix asks us how long to wait between frames.
+ *
+ * Effects declare how much they move next to their RGB_MATRIX_EFFECT:
+ *
+ *   RGB_MATRIX_EFFECT(PALETTEFX_GRADIENT)
+ *   RGB_MATRIX_EFFECT_CLASS(PALETTEFX_GRADIENT, RGB_EFFECT_STATIC)
+ *
+ * Undeclared effects are treated as fast. Blinking indicators, crossfades and
+ * recent input always get the full rate, and any change in the RGB config,
+ * layers, host LEDs or input redraws a static scene straight away.
+ */
+enum rgb_effect_class {
+    RGB_EFFECT_STATIC, // only changes with state, e.g. SOLID_COLOR
+    RGB_EFFECT_SLOW,   // animates, but a low frame rate is enough
+    RGB_EFFECT_FAST,   // needs the full frame rate to look smooth
+};
+
+/**
+ * @brief Returns how many ms to wait before the next frame, see RGB_MATRIX_LED_FLUSH_LIMIT.
+ */
+uint32_t rgb_governor_flush_limit(void);
+
+/**
+ * @brief Forces a redraw for state the governor can't see, e.g. an edited palette.
+ */
+void rgb_governor_kick(void);
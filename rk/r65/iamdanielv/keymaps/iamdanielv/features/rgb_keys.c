@@ -2,6 +2,8 @@
 #include "defines.h"
 #include "rgb_keys.h"
 #include "indicator_queue.h"
+#include "fast_hsv.h"
+#include "rgb_pipeline.h"
 
 /**
  * @brief Processes RGB keycodes.
@@ -27,7 +29,7 @@ bool process_rgb_keys(uint16_t keycode, keyrecord_t *record) {
                     } break;
                     default: {
                         HSV current_hsv = rgb_matrix_get_hsv();
-                        RGB rgb         = hsv_to_rgb(current_hsv);
+                        RGB rgb         = fast_hsv_to_rgb(current_hsv);
                         rgb_matrix_set_color_all(rgb.r, rgb.g, rgb.b);
                         rgb_matrix_set_flags_noeeprom(LED_FLAG_ALL);
                         blink_space(true);
@@ -37,16 +39,19 @@ bool process_rgb_keys(uint16_t keycode, keyrecord_t *record) {
             return false;
         case RM_NEXT:
             if (record->event.pressed) {
+                rgb_pipeline_crossfade_start();
                 rgb_matrix_step_noeeprom();
             }
             return false;
         case RM_PREV:
             if (record->event.pressed) {
+                rgb_pipeline_crossfade_start();
                 rgb_matrix_step_reverse_noeeprom();
             }
             return false;
         case RGB_M_P:
             if (record->event.pressed) {
+                rgb_pipeline_crossfade_start();
                 rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
                 blink_space(true);
             }
@@ -87,6 +92,7 @@ bool process_rgb_keys(uint16_t keycode, keyrecord_t *record) {
                 } else {
                     indicator_enqueue(O_KI, INDCTR_INTVL_FAST, INDCTR_FLSH_SINGLE, RGB_WHITE); // O - UP
                 }
+                rgb_pipeline_crossfade_start();
                 rgb_matrix_increase_hue_noeeprom();
             }
             return false;
@@ -102,6 +108,7 @@ bool process_rgb_keys(uint16_t keycode, keyrecord_t *record) {
                 } else {
                     indicator_enqueue(I_KI, INDCTR_INTVL_FAST, INDCTR_FLSH_SINGLE, RGB_WHITE); // I - DOWN
                 }
+                rgb_pipeline_crossfade_start();
                 rgb_matrix_decrease_hue_noeeprom();
             }
             return false;
@@ -0,0 +1,93 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "user_palettes.h"
+#include "hid_commands.h"
+#include "palettefx.h"
+#include "rgb_governor.h"
+
+_Static_assert(sizeof(user_palettes_store_t) <= EECONFIG_USER_DATA_SIZE, "EECONFIG_USER_DATA_SIZE is too small for the user palettes");
+
+uint16_t palettefx_user_palettes[PALETTEFX_USER_PALETTE_COUNT][16];
+
+// true once the EEPROM holds a full set of palettes
+static bool palettes_stored = false;
+
+#define USER_PALETTE_SIZE sizeof(palettefx_user_palettes[0])
+
+/**
+ * @brief Loads the user palettes from EEPROM into RAM.
+ */
+void user_palettes_init(void) {
+    uint16_t magic = 0;
+    eeconfig_read_user_datablock(&magic, offsetof(user_palettes_store_t, magic), sizeof(magic));
+
+    palettes_stored = (magic == USER_PALETTES_MAGIC);
+    if (palettes_stored) {
+        eeconfig_read_user_datablock(palettefx_user_palettes, offsetof(user_palettes_store_t, colors), sizeof(palettefx_user_palettes));
+        return;
+    }
+
+    // nothing stored yet, start from the built-in palettes
+    uint8_t num_builtin = palettefx_num_palettes() - PALETTEFX_USER_PALETTE_COUNT;
+    for (uint8_t slot = 0; slot < PALETTEFX_USER_PALETTE_COUNT; slot++) {
+        const uint16_t *builtin = palettefx_get_palette_data_by_index(slot % num_builtin);
+        for (uint8_t i = 0; i < 16; i++) {
+            palettefx_user_palettes[slot][i] = pgm_read_word(&builtin[i]);
+        }
+    }
+}
+
+/**
+ * @brief Handles the HID_CMD_PALETTE_* raw HID commands.
+ *
+ * @param data The packet, the reply data is written back into it.
+ * @param length The length of the packet.
+ * @return One of `hid_command_status`.
+ */
+uint8_t user_palettes_hid_command(uint8_t *data, uint8_t length) {
+    uint8_t *args = &data[HID_CMD_ARGS];
+    uint8_t  slot = args[0];
+    if (slot >= PALETTEFX_USER_PALETTE_COUNT) {
+        return HID_STATUS_BAD_ARGS;
+    }
+
+    if (data[0] == HID_CMD_PALETTE_SAVE) {
+        if (palettes_stored) {
+            eeconfig_update_user_datablock(palettefx_user_palettes[slot], offsetof(user_palettes_store_t, colors) + slot * USER_PALETTE_SIZE, USER_PALETTE_SIZE);
+        } else {
+            // first save, write every slot so the others don't load back as garbage
+            uint16_t magic = USER_PALETTES_MAGIC;
+            eeconfig_update_user_datablock(palettefx_user_palettes, offsetof(user_palettes_store_t, colors), sizeof(palettefx_user_palettes));
+            eeconfig_update_user_datablock(&magic, offsetof(user_palettes_store_t, magic), sizeof(magic));
+            palettes_stored = true;
+        }
+        return HID_STATUS_OK;
+    }
+
+    uint8_t first = args[1];
+    uint8_t count = args[2];
+    // SET needs 4 header bytes plus 2 bytes per color, GET replies with 3 plus 2 per color
+    if (first >= 16 || count > 16 - first || 4 + 2 * count > length) {
+        return HID_STATUS_BAD_ARGS;
+    }
+
+    if (data[0] == HID_CMD_PALETTE_SET) {
+        const uint8_t *colors = &args[3];
+        for (uint8_t i = 0; i < count; i++) {
+            palettefx_user_palettes[slot][first + i] = colors[2 * i] | (colors[2 * i + 1] << 8);
+        }
+        rgb_governor_kick();
+        return HID_STATUS_OK;
+    }
+
+    // HID_CMD_PALETTE_GET
+    uint8_t *reply = &data[HID_CMD_DATA];
+    reply[0]       = count;
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t color   = palettefx_user_palettes[slot][first + i];
+        reply[1 + 2 * i] = color & 0xFF;
+        reply[2 + 2 * i] = color >> 8;
+    }
+    return HID_STATUS_OK;
+}
@@ -0,0 +1,42 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Bumped whenever the layout of the stored palettes changes
+#define USER_PALETTES_MAGIC 0x5046
+
+/**
+ * @brief How the user palettes are laid out in the EEPROM user datablock.
+ */
+typedef struct {
+    uint16_t magic;
+    uint16_t colors[PALETTEFX_USER_PALETTE_COUNT][16];
+} user_palettes_store_t;
+
+/**
+ * @brief The RAM copy of the user palettes, the PaletteFx effects read from it.
+ */
+extern uint16_t palettefx_user_palettes[PALETTEFX_USER_PALETTE_COUNT][16];
+
+/**
+ * @brief Loads the user palettes from EEPROM into RAM.
+ *
+ * If nothing valid has been stored yet, the slots start out as copies of the
+ * built-in palettes. Call this from `keyboard_post_init_user`.
+ */
+void user_palettes_init(void);
+
+/**
+ * @brief Handles the HID_CMD_PALETTE_* raw HID commands.
+ *
+ * Setting colors only changes the RAM copy so they can be previewed live,
+ * HID_CMD_PALETTE_SAVE writes a slot to EEPROM.
+ *
+ * @param data The packet, the reply data is written back into it.
+ * @param length The length of the packet.
+ * @return One of `hid_command_status`.
+ */
+uint8_t user_palettes_hid_command(uint8_t *data, uint8_t length);
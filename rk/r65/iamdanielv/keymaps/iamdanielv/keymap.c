@@ -11,6 +11,13 @@
 #include "features/tap_hold.h"
 #include "features/indicators.h"
 #include "features/rgb_keys.h"
+#include "features/layer_palettes.h"
+#include "features/heatmap.h"
+#include "features/user_palettes.h"
+#include "features/host_stream.h"
+#include "features/key_color_map.h"
+#include "features/encoder_accel.h"
+#include "features/hires_scroll.h"
 
 /**
  * @brief Manages keyboard-related tasks, including LED indicators.
@@ -18,6 +25,7 @@
  * This function is responsible for controlling the MAC LED based on the active layer
  * (KBCTL_LYR) or if FN key mode is enabled. It also re-uses the Win Lock LED as a
  * NumLock indicator if `keymap_config.no_gui` is not enabled and the NUM_LYR is active.
+ * It also ends host streaming once the host goes quiet and sends waiting encoder steps.
  */
 void housekeeping_task_user(void) {
     // Note: We can decide what to do with the MAC Led in this function
@@ -43,6 +51,19 @@ void housekeeping_task_user(void) {
             }
         } /**< else we are not on the num layer, ignore */
     } /**< else we have enabled no_gui, skip re-using the LED */
+
+    host_stream_task();
+    encoder_accel_task();
+}
+
+/**
+ * @brief Runs once the keyboard is fully initialized.
+ *
+ * Loads the runtime PaletteFx palettes and the key color maps from EEPROM.
+ */
+void keyboard_post_init_user(void) {
+    user_palettes_init();
+    key_color_map_init();
 }
 
 bool fn_mode_enabled = false;
@@ -52,9 +73,9 @@ bool recalculate_rgb = true;
  * @brief Custom processing of keycodes and tap dance actions
  */
 /**
- * @brief Defines custom keycode for swapping FN mode.
+ * @brief Defines custom keycodes for swapping FN mode and the high resolution scroll wheel.
  */
-enum custom_keycodes { KC_SWP_FN = SAFE_RANGE };
+enum custom_keycodes { KC_SWP_FN = SAFE_RANGE, KC_HRS_UP, KC_HRS_DN };
 
 // clang-format off
 /**
@@ -143,10 +164,36 @@ const uint16_t PROGMEM encoder_map[][NUM_ENCODERS][NUM_DIRECTIONS] = {
     [HRM_BASE_LYR]  = {ENCODER_CCW_CW(_______, _______)},
     [EXT_LYR]       = {ENCODER_CCW_CW(_______, _______)},
     [KBCTL_LYR]     = {ENCODER_CCW_CW(_______, _______)},
-    [NUM_LYR]       = {ENCODER_CCW_CW(_______, _______)},
+    [NUM_LYR]       = {ENCODER_CCW_CW(KC_HRS_DN, KC_HRS_UP)},
     [MEDIA_LYR]     = {ENCODER_CCW_CW(_______, _______)},
 };
 #endif
+
+/**
+ * @brief Encoder acceleration for each layer, see encoder_accel.h.
+ */
+const encoder_accel_t PROGMEM encoder_accel_map[][NUM_ENCODERS] = {
+    [BASE_LYR]      = {ENCODER_ACCEL(80, 20, 4)},
+    [HRM_BASE_LYR]  = {ENCODER_ACCEL_OFF},
+    [EXT_LYR]       = {ENCODER_ACCEL_OFF},
+    [KBCTL_LYR]     = {ENCODER_ACCEL_OFF},
+    [NUM_LYR]       = {ENCODER_ACCEL_OFF},
+    [MEDIA_LYR]     = {ENCODER_ACCEL_OFF},
+};
+const uint8_t encoder_accel_map_count = ARRAY_SIZE(encoder_accel_map);
+
+/**
+ * @brief PaletteFx palette for each layer, LAYER_PALETTE_NONE follows the hue setting.
+ */
+const uint8_t PROGMEM layer_palettes[] = {
+    [BASE_LYR]      = LAYER_PALETTE_NONE,
+    [HRM_BASE_LYR]  = LAYER_PALETTE_NONE,
+    [EXT_LYR]       = LAYER_PALETTE_NONE,
+    [KBCTL_LYR]     = PALETTEFX_THERMAL,
+    [NUM_LYR]       = LAYER_PALETTE_NONE,
+    [MEDIA_LYR]     = PALETTEFX_SYNTHWAVE,
+};
+const uint8_t layer_palettes_count = ARRAY_SIZE(layer_palettes);
 // clang-format on
 
 /**
@@ -171,6 +218,8 @@ inline bool handle_nkro_toggle(keyrecord_t *record) __attribute__((always_inline
  * @return True if the pipeline should continue processing, false if the key was handled here.
  */
 bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    if (!process_encoder_accel(keycode, record)) { return false; }
+    heatmap_record(record);
 
     // Check for any layer lock or toggle key press
     if (keycode == QK_LLCK || IS_QK_TOGGLE_LAYER(keycode))
@@ -191,6 +240,14 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
         return false;
     }
 
+    if (keycode == KC_HRS_UP || keycode == KC_HRS_DN) {
+        // the knob scrolls in fractions of a notch, see features/hires_scroll.c
+        if (record->event.pressed) {
+            hires_scroll_detent(keycode == KC_HRS_UP);
+        }
+        return false;
+    }
+
     if (!process_fn_mode(keycode, record)) { return false; }
     if (!process_rgb_keys(keycode, record)) { return false; }
     if (!dv_process_layer_lock(keycode, record, QK_LLCK)) { return false; }
@@ -209,6 +266,19 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
     return true;
 }
 
+/**
+ * @brief Called whenever the layer state changes.
+ *
+ * Switches to the PaletteFx palette bound to the new highest layer.
+ *
+ * @param state The new layer state bitmask.
+ * @return The layer state to use.
+ */
+layer_state_t layer_state_set_user(layer_state_t state) {
+    layer_palettes_update(state);
+    return state;
+}
+
 /**
  * @brief Called whenever the layer lock state changes.
  *
@@ -2,11 +2,34 @@
 TAP_DANCE_ENABLE = yes
 #LAYER_LOCK_ENABLE = yes
 ENCODER_MAP_ENABLE = yes
+RAW_ENABLE = yes
+POINTING_DEVICE_ENABLE = yes
+POINTING_DEVICE_DRIVER = custom
 SRC += features/indicator_queue.c
 SRC += features/fn_mode.c
 SRC += features/tap_hold.c
 SRC += features/indicators.c
 SRC += features/rgb_keys.c
 SRC += features/dv_layer_lock.c
+SRC += features/fast_hsv.c
+SRC += features/layer_palettes.c
+SRC += features/heatmap.c
+SRC += features/user_palettes.c
+SRC += features/hid_commands.c
+SRC += features/effect_bench.c
+SRC += features/rgb_governor.c
+SRC += features/led_budget.c
+SRC += features/host_stream.c
+SRC += features/key_color_map.c
+SRC += features/led_lookup.c
+SRC += features/encoder_accel.c
+SRC += features/hires_scroll.c
+
+# LED index tables (led_index_tables.h in the build src dir) are generated from keyboard.json
+LED_INDEX_TABLES_H := $(INTERMEDIATE_OUTPUT)/src/led_index_tables.h
+$(LED_INDEX_TABLES_H): $(KEYMAP_PATH)/../../keyboard.json $(KEYMAP_PATH)/tools/gen_led_tables.py
+	@mkdir -p $(@D)
+	python3 $(KEYMAP_PATH)/tools/gen_led_tables.py $< -o $@
+generated-files: $(LED_INDEX_TABLES_H)
 
 RGB_MATRIX_CUSTOM_USER = yes
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+# Copyright 2025 DV (@iamdanielv)
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Benchmarks every RGB effect at every speed on the keyboard (features/effect_bench.h).
+
+Each mode and speed is one HID_CMD_BENCH_RUN:
+
+    request: [mode] [speed] [frames]
+    reply:   [cycles per frame u32] [worst frame u32] [cycles per LED u16] [checksum u32] [frames]
+
+The modes are probed from 1 up until the keyboard refuses one, so the sweep
+covers whatever effects the firmware was built with, PaletteFx included.
+The results go out as CSV. With --compare, the checksums are checked against
+an earlier CSV, so an optimisation can be shown to render the same frames.
+
+    bench_sweep.py > before.csv
+    bench_sweep.py --compare before.csv > after.csv
+"""
+
+import argparse
+import csv
+import struct
+import sys
+
+import rawhid
+
+# the bench boosts the clock, the cycle counts are at the full 96 MHz
+CPU_MHZ = 96
+
+DEFAULT_SPEEDS = [0, 64, 128, 192, 255]
+MAX_MODES = 255
+
+REPLY = struct.Struct('<IIHIB')
+
+FIELDS = ['mode', 'speed', 'frames', 'cycles_per_frame', 'us_per_frame', 'worst_cycles', 'worst_us', 'cycles_per_led', 'checksum']
+
+
+def bench(transport, mode, speed, frames=0, timeout=10.0):
+    """Runs one benchmark, returns a row of FIELDS. A 0 frame count uses the keyboard's default."""
+    data = rawhid.command(transport, rawhid.CMD_BENCH_RUN, bytes([mode, speed, frames]), timeout)
+    average, worst, per_led, checksum, rendered = REPLY.unpack_from(data)
+    return {
+        'mode': mode,
+        'speed': speed,
+        'frames': rendered,
+        'cycles_per_frame': average,
+        'us_per_frame': round(average / CPU_MHZ, 1),
+        'worst_cycles': worst,
+        'worst_us': round(worst / CPU_MHZ, 1),
+        'cycles_per_led': per_led,
+        'checksum': '%08x' % checksum,
+    }
+
+
+def sweep(transport, speeds=DEFAULT_SPEEDS, frames=0, modes=None):
+    """Yields a row per mode and speed, over `modes` or every mode the keyboard takes."""
+    for mode in modes or range(1, MAX_MODES + 1):
+        for speed in speeds:
+            try:
+                yield bench(transport, mode, speed, frames)
+            except rawhid.HidError as e:
+                if modes is None and e.status == rawhid.STATUS_BAD_ARGS:
+                    return  # past the last mode
+                raise
+
+
+def compare(rows, baseline):
+    """The (mode, speed) pairs whose checksum differs from the baseline rows, for the pairs in both."""
+    expected = {(int(r['mode']), int(r['speed']), int(r['frames'])): r['checksum'] for r in baseline}
+    changed = []
+    for row in rows:
+        key = (row['mode'], row['speed'], row['frames'])
+        if key in expected and expected[key] != row['checksum']:
+            changed.append(key[:2])
+    return changed
+
+
+def parse_list(text):
+    return [int(v, 0) for v in text.split(',')]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--speeds', type=parse_list, default=DEFAULT_SPEEDS, help='comma separated, default %(default)s')
+    parser.add_argument('--modes', type=parse_list, help='comma separated, every mode when left out')
+    parser.add_argument('--frames', type=int, default=0, help='frames per run, 0 for the keyboard default')
+    parser.add_argument('--compare', metavar='CSV', help='check the checksums against an earlier sweep')
+    parser.add_argument('--device', help='hidraw node, found by VID/PID when left out')
+    parser.add_argument('--stub', action='store_true', help='no keyboard, sweep 3 made up modes')
+    args = parser.parse_args()
+
+    if not 0 <= args.frames <= 255 or not all(0 <= s <= 255 for s in args.speeds):
+        parser.error('frames and speeds are bytes')
+
+    if args.stub:
+        def fake(report):
+            mode, speed, frames = report[1:4]
+            if mode > 3:
+                return bytes([report[0], rawhid.STATUS_BAD_ARGS]) + bytes(rawhid.REPORT_SIZE - 2)
+            cycles = 20000 * mode + 40 * speed
+            return rawhid.reply_ok(report, REPLY.pack(cycles, cycles * 2, cycles // 66, mode << 8 | speed, frames or 64))
+        transport = rawhid.StubTransport(fake)
+    else:
+        transport = rawhid.HidrawTransport(args.device)
+
+    baseline = None
+    if args.compare:
+        with open(args.compare, newline='') as f:
+            baseline = list(csv.DictReader(f))
+
+    writer = csv.DictWriter(sys.stdout, FIELDS)
+    writer.writeheader()
+    rows = []
+    with transport:
+        for row in sweep(transport, args.speeds, args.frames, args.modes):
+            writer.writerow(row)
+            sys.stdout.flush()
+            rows.append(row)
+
+    if baseline is not None:
+        changed = compare(rows, baseline)
+        for mode, speed in changed:
+            print('mode %d speed %d renders different frames' % (mode, speed), file=sys.stderr)
+        if changed:
+            sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+# Copyright 2025 DV (@iamdanielv)
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Generates led_index_tables.h from keyboard.json.
+
+The LED of every labelled key in the LAYOUT becomes a `<LABEL>_KI` constant,
+and the matrix <-> LED lookups and per-row/column LED masks are written out as
+initializers for features/led_lookup.c. The LED positions and flags are
+written out too, for the host effect bench in tests/. rules.mk runs this on
+every build, so the tables can never drift from the rgb_matrix layout.
+
+    gen_led_tables.py keyboard.json -o led_index_tables.h
+"""
+
+import argparse
+import json
+import re
+import sys
+
+NO_LED = 255
+NO_MATRIX = 255
+# QMK's RGB_MATRIX_CENTER when keyboard.json has no center_point
+DEFAULT_CENTER = [112, 32]
+MASK_WORDS_BITS = 32
+
+
+def label_to_name(label):
+    """'Left Sft' -> LEFT_SFT, '1' -> N1"""
+    name = re.sub(r'[^0-9A-Za-z]+', '_', label).strip('_').upper()
+    if not name:
+        return None
+    if name[0].isdigit():
+        name = 'N' + name
+    return name
+
+
+def c_array(values):
+    return '{' + ', '.join(str(v) for v in values) + '}'
+
+
+def mask_words(leds, words):
+    mask = [0] * words
+    for led in leds:
+        mask[led // MASK_WORDS_BITS] |= 1 << (led % MASK_WORDS_BITS)
+    return '{' + ', '.join('0x%08XUL' % m for m in mask) + '}'
+
+
+def generate(info):
+    rows = len(info['matrix_pins']['rows'])
+    cols = len(info['matrix_pins']['cols'])
+    leds = info['rgb_matrix']['layout']
+    words = (len(leds) + MASK_WORDS_BITS - 1) // MASK_WORDS_BITS
+
+    matrix_to_led = [[NO_LED] * cols for _ in range(rows)]
+    led_to_matrix = []
+    for index, led in enumerate(leds):
+        if 'matrix' in led:
+            row, col = led['matrix']
+            matrix_to_led[row][col] = index
+            led_to_matrix.append((row << 4) | col)
+        else:
+            led_to_matrix.append(NO_MATRIX)
+
+    names = []
+    for layout in info['layouts'].values():
+        for key in layout['layout']:
+            name = label_to_name(key.get('label', ''))
+            if not name:
+                continue
+            row, col = key['matrix']
+            led = matrix_to_led[row][col]
+            if led == NO_LED:
+                continue  # e.g. the encoder press has no LED
+            if name in dict(names):
+                if dict(names)[name] != led:
+                    sys.exit('gen_led_tables: label %s is used for two LEDs' % name)
+                continue
+            names.append((name, led))
+
+    out = []
+    out.append('// Generated by tools/gen_led_tables.py from keyboard.json, do not edit.')
+    out.append('')
+    out.append('#pragma once')
+    out.append('')
+    out.append('#define LED_TABLES_LED_COUNT %d' % len(leds))
+    out.append('#define LED_TABLES_ROWS %d' % rows)
+    out.append('#define LED_TABLES_COLS %d' % cols)
+    out.append('#define LED_TABLES_MASK_WORDS %d' % words)
+    out.append('')
+    out.append('// LED index of each labelled key')
+    for name, led in names:
+        out.append('#define %s_KI %d' % (name, led))
+    out.append('')
+    out.append('// [row][col] -> LED index, %d where a key has no LED' % NO_LED)
+    out.append('#define LED_TABLES_MATRIX_TO_LED { \\')
+    for row in matrix_to_led:
+        out.append('    %s, \\' % c_array(row))
+    out.append('}')
+    out.append('')
+    out.append('// LED index -> row << 4 | col, %d for LEDs without a key' % NO_MATRIX)
+    out.append('#define LED_TABLES_LED_TO_MATRIX %s' % c_array(led_to_matrix))
+    out.append('')
+    out.append('// bit i of word i / 32 is set when LED i sits on that row / column')
+    out.append('#define LED_TABLES_ROW_MASKS { \\')
+    for row in matrix_to_led:
+        out.append('    %s, \\' % mask_words([led for led in row if led != NO_LED], words))
+    out.append('}')
+    out.append('#define LED_TABLES_COL_MASKS { \\')
+    for col in range(cols):
+        col_leds = [matrix_to_led[row][col] for row in range(rows) if matrix_to_led[row][col] != NO_LED]
+        out.append('    %s, \\' % mask_words(col_leds, words))
+    out.append('}')
+    out.append('')
+    out.append('// g_led_config as QMK builds it from keyboard.json, for builds outside QMK')
+    out.append('#define LED_TABLES_POINTS {%s}' % ', '.join(c_array([led['x'], led['y']]) for led in leds))
+    out.append('#define LED_TABLES_FLAGS %s' % c_array([led.get('flags', 0) for led in leds]))
+    out.append('#define LED_TABLES_CENTER %s' % c_array(info['rgb_matrix'].get('center_point', DEFAULT_CENTER)))
+    out.append('')
+    return '\n'.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('keyboard_json')
+    parser.add_argument('-o', '--output', required=True)
+    args = parser.parse_args()
+
+    with open(args.keyboard_json) as f:
+        header = generate(json.load(f))
+
+    # leave the file alone when nothing changed so dependent objects aren't rebuilt
+    try:
+        with open(args.output) as f:
+            if f.read() == header:
+                return
+    except OSError:
+        pass
+    with open(args.output, 'w') as f:
+        f.write(header)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+# Copyright 2025 DV (@iamdanielv)
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Streams LED frames to the keyboard over raw HID (features/host_stream.h).
+
+A frame goes out in HID_CMD_STREAM_FRAME chunks of up to 9 LEDs:
+
+    [first LED] [count] [flags] [R G B ...]
+
+and the chunk flagged END shows it. The keyboard starts the next frame from
+the one it shows, so after the first frame only the runs of LEDs that changed
+are sent. The keyboard goes back to its own effect once frames stop coming.
+
+    host_stream.py rainbow --fps 30 --seconds 10
+    host_stream.py chase --stub       # no keyboard, print what would be sent
+"""
+
+import argparse
+import colorsys
+import sys
+import time
+
+import rawhid
+
+LED_COUNT = 66
+LEDS_PER_CHUNK = (rawhid.MAX_ARGS - 3) // 3
+FLAG_END = 0x01
+
+
+def chunk(first, colors, end=False):
+    """The arguments of one HID_CMD_STREAM_FRAME chunk."""
+    if len(colors) > LEDS_PER_CHUNK:
+        raise ValueError('%d LEDs, a chunk holds %d' % (len(colors), LEDS_PER_CHUNK))
+    args = bytearray([first, len(colors), FLAG_END if end else 0])
+    for r, g, b in colors:
+        args += bytes([r, g, b])
+    return bytes(args)
+
+
+def changed_runs(frame, previous=None):
+    """(first, last + 1) of every run of LEDs that differs from `previous`, the whole frame without one."""
+    if previous is None:
+        return [(0, len(frame))]
+
+    runs = []
+    start = None
+    for i, color in enumerate(frame):
+        if tuple(color) != tuple(previous[i]):
+            if start is None:
+                start = i
+        elif start is not None:
+            runs.append((start, i))
+            start = None
+    if start is not None:
+        runs.append((start, len(frame)))
+    return runs
+
+
+def frame_chunks(frame, previous=None):
+    """The chunks that take the keyboard from `previous` to `frame`, the last one is flagged END."""
+    chunks = []
+    for start, stop in changed_runs(frame, previous):
+        for first in range(start, stop, LEDS_PER_CHUNK):
+            chunks.append((first, frame[first:min(first + LEDS_PER_CHUNK, stop)]))
+
+    if not chunks:
+        # nothing changed, still show the frame so the stream doesn't time out
+        chunks.append((0, frame[:1]))
+
+    return [chunk(first, colors, end=(i == len(chunks) - 1)) for i, (first, colors) in enumerate(chunks)]
+
+
+def send_frame(transport, frame, previous=None):
+    """Sends a frame, only the changed LEDs if `previous` is what the keyboard shows. Returns the chunk count."""
+    chunks = frame_chunks(frame, previous)
+    for args in chunks:
+        rawhid.command(transport, rawhid.CMD_STREAM_FRAME, args)
+    return len(chunks)
+
+
+def rainbow(t, count):
+    frame = []
+    for i in range(count):
+        r, g, b = colorsys.hsv_to_rgb((i / count + t * 0.25) % 1.0, 1.0, 1.0)
+        frame.append((int(r * 255), int(g * 255), int(b * 255)))
+    return frame
+
+
+def chase(t, count):
+    lit = int(t * 20) % count
+    return [(255, 255, 255) if i == lit else (0, 0, 32) for i in range(count)]
+
+
+def solid(t, count):
+    return [(255, 96, 0)] * count
+
+
+PATTERNS = {'rainbow': rainbow, 'chase': chase, 'solid': solid}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('pattern', choices=sorted(PATTERNS))
+    parser.add_argument('--fps', type=float, default=30)
+    parser.add_argument('--seconds', type=float, default=10)
+    parser.add_argument('--leds', type=int, default=LED_COUNT)
+    parser.add_argument('--full', action='store_true', help='send every LED of every frame')
+    parser.add_argument('--device', help='hidraw node, found by VID/PID when left out')
+    parser.add_argument('--stub', action='store_true', help='no keyboard, print the chunks instead')
+    args = parser.parse_args()
+
+    if args.stub:
+        def show(report):
+            print(report.hex(' '))
+            return rawhid.reply_ok(report)
+        transport = rawhid.StubTransport(show)
+    else:
+        transport = rawhid.HidrawTransport(args.device)
+
+    pattern = PATTERNS[args.pattern]
+    previous = None
+    chunks = 0
+    frames = 0
+    start = time.monotonic()
+    with transport:
+        while True:
+            t = time.monotonic() - start
+            if t >= args.seconds:
+                break
+            frame = pattern(t, args.leds)
+            chunks += send_frame(transport, frame, None if args.full else previous)
+            previous = frame
+            frames += 1
+            time.sleep(max(0.0, frames / args.fps - (time.monotonic() - start)))
+
+    print('%d frames, %d chunks' % (frames, chunks), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
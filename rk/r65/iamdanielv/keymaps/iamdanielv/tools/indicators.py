@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+# Copyright 2025 DV (@iamdanielv)
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Queues indicator flashes on the keyboard over raw HID (features/indicator_queue.h).
+
+HID_CMD_INDICATORS carries a batch of queue operations:
+
+    [count] then count entries of [led] [interval] [flashes] [R] [G] [B]
+
+The interval is in 10 ms steps and must be at least 1, flashes go up to 127,
+and 0 flashes takes the LED out of the queue. The keyboard refuses the whole
+batch if any entry is out of range, so the same limits are checked here first.
+
+    indicators.py flash 30 --flashes 3 --interval 200 --color ff0000
+    indicators.py clear 30
+"""
+
+import argparse
+from collections import namedtuple
+
+import rawhid
+
+LED_COUNT = 66
+ENTRY_SIZE = 6
+INTERVAL_UNIT_MS = 10
+MAX_INTERVAL_MS = 255 * INTERVAL_UNIT_MS
+MAX_FLASHES = 127
+ENTRIES_PER_PACKET = (rawhid.MAX_ARGS - 1) // ENTRY_SIZE
+
+Indicator = namedtuple('Indicator', 'led interval_ms flashes color')
+
+
+def flash(led, interval_ms=200, flashes=1, color=(255, 255, 255)):
+    """An entry that flashes `led` `flashes` times, `interval_ms` per on and per off step."""
+    return Indicator(led, interval_ms, flashes, tuple(color))
+
+
+def clear(led):
+    """An entry that takes `led` out of the queue."""
+    return Indicator(led, 0, 0, (0, 0, 0))
+
+
+def encode_entry(indicator, led_count=LED_COUNT):
+    """The 6 bytes of one entry, ValueError if the keyboard would refuse it."""
+    led, interval_ms, flashes, color = indicator
+    if not 0 <= led < led_count:
+        raise ValueError('LED %d is not one of the %d LEDs' % (led, led_count))
+    if not 0 <= flashes <= MAX_FLASHES:
+        raise ValueError('%d flashes, at most %d fit' % (flashes, MAX_FLASHES))
+    if len(color) != 3 or not all(0 <= c <= 255 for c in color):
+        raise ValueError('color %r is not three bytes' % (color,))
+
+    interval = 0
+    if flashes:
+        # round up, so a short interval never becomes 0
+        interval = -(-interval_ms // INTERVAL_UNIT_MS)
+        if not 1 <= interval <= 255:
+            raise ValueError('interval %d ms is outside 1 - %d ms' % (interval_ms, MAX_INTERVAL_MS))
+
+    return bytes([led, interval, flashes]) + bytes(color)
+
+
+def encode(indicators, led_count=LED_COUNT):
+    """The arguments of the HID_CMD_INDICATORS packets for a list of entries, at most 5 per packet."""
+    entries = [encode_entry(i, led_count) for i in indicators]
+    packets = []
+    for first in range(0, len(entries), ENTRIES_PER_PACKET):
+        batch = entries[first:first + ENTRIES_PER_PACKET]
+        packets.append(bytes([len(batch)]) + b''.join(batch))
+    return packets
+
+
+def decode(args):
+    """The entries of one packet's arguments, the inverse of encode() with the interval in ms."""
+    count = args[0]
+    indicators = []
+    for i in range(count):
+        entry = args[1 + i * ENTRY_SIZE:1 + (i + 1) * ENTRY_SIZE]
+        indicators.append(Indicator(entry[0], entry[1] * INTERVAL_UNIT_MS, entry[2], tuple(entry[3:6])))
+    return indicators
+
+
+def send(transport, indicators, led_count=LED_COUNT):
+    """Queues the entries, one packet per 5."""
+    for args in encode(indicators, led_count):
+        rawhid.command(transport, rawhid.CMD_INDICATORS, args)
+
+
+def parse_color(text):
+    value = int(text.lstrip('#'), 16)
+    return ((value >> 16) & 0xFF, (value >> 8) & 0xFF, value & 0xFF)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('action', choices=['flash', 'clear'])
+    parser.add_argument('leds', type=int, nargs='+')
+    parser.add_argument('--interval', type=int, default=200, help='ms per on and per off step')
+    parser.add_argument('--flashes', type=int, default=1)
+    parser.add_argument('--color', type=parse_color, default=(255, 255, 255), help='RRGGBB')
+    parser.add_argument('--device', help='hidraw node, found by VID/PID when left out')
+    parser.add_argument('--stub', action='store_true', help='no keyboard, print the packets instead')
+    args = parser.parse_args()
+
+    if args.action == 'flash':
+        indicators = [flash(led, args.interval, args.flashes, args.color) for led in args.leds]
+    else:
+        indicators = [clear(led) for led in args.leds]
+
+    try:
+        encode(indicators)
+    except ValueError as e:
+        parser.error(str(e))
+
+    if args.stub:
+        def show(report):
+            print(report.hex(' '))
+            return rawhid.reply_ok(report)
+        transport = rawhid.StubTransport(show)
+    else:
+        transport = rawhid.HidrawTransport(args.device)
+
+    with transport:
+        send(transport, indicators)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,189 @@
+# Copyright 2025 DV (@iamdanielv)
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Raw HID transport for the keymap's host commands (features/hid_commands.h).
+
+Every command is one 32 byte report, and the keyboard answers with the same
+report carrying the status in byte 1:
+
+    request: [cmd] [args ...]
+    reply:   [cmd] [status] [data ...]
+
+HidrawTransport talks to the keyboard through Linux hidraw. StubTransport
+stands in for it in tests and dry runs: it records what was sent and answers
+through a handler, OK with no data by default.
+"""
+
+import glob
+import os
+import select
+
+VENDOR_ID = 0x342D
+PRODUCT_ID = 0xE453
+
+# QMK's raw HID interface, RAW_USAGE_PAGE / RAW_USAGE_ID
+USAGE_PAGE = 0xFF60
+USAGE = 0x61
+
+REPORT_SIZE = 32
+
+# Offset of the first argument in a request, and of the first data byte in a reply
+CMD_ARGS = 1
+CMD_DATA = 2
+MAX_ARGS = REPORT_SIZE - CMD_ARGS
+
+# hid_command_id
+CMD_PALETTE_GET = 0x40
+CMD_PALETTE_SET = 0x41
+CMD_PALETTE_SAVE = 0x42
+CMD_BENCH_RUN = 0x43
+CMD_STREAM_FRAME = 0x44
+CMD_INDICATORS = 0x45
+CMD_KEY_COLORS_GET = 0x46
+CMD_KEY_COLORS_SET = 0x47
+CMD_KEY_COLORS_SAVE = 0x48
+
+# hid_command_status
+STATUS_OK = 0x00
+STATUS_BAD_COMMAND = 0x01
+STATUS_BAD_ARGS = 0x02
+STATUS_UNAVAILABLE = 0x03
+
+STATUS_NAMES = {
+    STATUS_OK: 'ok',
+    STATUS_BAD_COMMAND: 'bad command',
+    STATUS_BAD_ARGS: 'bad arguments',
+    STATUS_UNAVAILABLE: 'unavailable',
+}
+
+
+class HidError(Exception):
+    """The keyboard answered with an error status, or not at all."""
+
+    def __init__(self, message, status=None):
+        super().__init__(message)
+        self.status = status
+
+
+def build_report(cmd, args=b''):
+    """[cmd] [args ...] zero padded to REPORT_SIZE."""
+    args = bytes(args)
+    if len(args) > MAX_ARGS:
+        raise ValueError('%d argument bytes, a report holds %d' % (len(args), MAX_ARGS))
+    return bytes([cmd]) + args + bytes(MAX_ARGS - len(args))
+
+
+def command(transport, cmd, args=b'', timeout=1.0):
+    """Sends one command and returns the data bytes of its reply, raises HidError on a bad status."""
+    transport.send(build_report(cmd, args))
+    reply = transport.receive(timeout)
+    if reply is None:
+        raise HidError('no reply to command 0x%02X' % cmd)
+    if reply[0] != cmd:
+        raise HidError('reply is for command 0x%02X, sent 0x%02X' % (reply[0], cmd))
+    status = reply[1]
+    if status != STATUS_OK:
+        raise HidError('command 0x%02X: %s' % (cmd, STATUS_NAMES.get(status, 'status 0x%02X' % status)), status)
+    return bytes(reply[CMD_DATA:])
+
+
+def _is_raw_hid(hidraw):
+    """True if /sys/class/hidraw/<hidraw> is the keyboard's raw HID interface."""
+    device = os.path.join('/sys/class/hidraw', hidraw, 'device')
+    try:
+        with open(os.path.join(device, 'uevent')) as f:
+            uevent = f.read()
+        with open(os.path.join(device, 'report_descriptor'), 'rb') as f:
+            descriptor = f.read()
+    except OSError:
+        return False
+
+    hid_id = 'HID_ID=%04X:%08X:%08X' % (0x0003, VENDOR_ID, PRODUCT_ID)
+    if hid_id not in uevent.upper():
+        return False
+
+    # Usage Page (0xFF60) then Usage (0x61), as a 2 byte and a 1 byte item
+    usage_page = bytes([0x06, USAGE_PAGE & 0xFF, USAGE_PAGE >> 8])
+    usage = bytes([0x09, USAGE])
+    at = descriptor.find(usage_page)
+    return at >= 0 and descriptor.find(usage, at) >= 0
+
+
+def find_devices():
+    """Returns the /dev/hidraw* paths of every connected keyboard's raw HID interface."""
+    found = []
+    for path in sorted(glob.glob('/sys/class/hidraw/hidraw*')):
+        name = os.path.basename(path)
+        if _is_raw_hid(name):
+            found.append('/dev/' + name)
+    return found
+
+
+class HidrawTransport:
+    """Linux hidraw, the node needs read and write access (a udev rule, or root)."""
+
+    def __init__(self, path=None):
+        if path is None:
+            devices = find_devices()
+            if not devices:
+                raise HidError('no keyboard found, looked for %04X:%04X usage page 0x%04X' % (VENDOR_ID, PRODUCT_ID, USAGE_PAGE))
+            path = devices[0]
+        self.path = path
+        self.fd = os.open(path, os.O_RDWR)
+
+    def send(self, report):
+        # the raw HID interface has no report ids, hidraw wants a 0 in front
+        os.write(self.fd, b'\x00' + bytes(report))
+
+    def receive(self, timeout):
+        ready, _, _ = select.select([self.fd], [], [], timeout)
+        if not ready:
+            return None
+        return os.read(self.fd, REPORT_SIZE)
+
+    def close(self):
+        os.close(self.fd)
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+
+def reply_ok(report, data=b''):
+    """The reply the keyboard sends for a command that worked."""
+    return bytes([report[0], STATUS_OK]) + bytes(data) + bytes(REPORT_SIZE - CMD_DATA - len(data))
+
+
+class StubTransport:
+    """Stands in for the keyboard: records the reports sent and answers through `handler`.
+
+    `handler(report)` returns the reply report, or None for no reply. The
+    default handler answers every command with STATUS_OK and no data.
+    """
+
+    def __init__(self, handler=None):
+        self.handler = handler or reply_ok
+        self.sent = []
+        self._replies = []
+
+    def send(self, report):
+        report = bytes(report)
+        if len(report) != REPORT_SIZE:
+            raise ValueError('report is %d bytes, not %d' % (len(report), REPORT_SIZE))
+        self.sent.append(report)
+        reply = self.handler(report)
+        if reply is not None:
+            self._replies.append(bytes(reply))
+
+    def receive(self, timeout):
+        return self._replies.pop(0) if self._replies else None
+
+    def close(self):
+        pass
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
@@ -0,0 +1,282 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+#include "matrix.h"
+#include "matrix_scan.h"
+#include "clock_governor.h"
+
+/**
+ * Timer driven matrix scan that reads whole GPIO ports (CUSTOM_MATRIX = lite, see rules.mk).
+ *
+ * The diodes are ROW2COL, so each column is driven low in turn and the rows
+ * that read low are the pressed keys. A hardware timer steps the scan one
+ * column per tick, so the scan rate stays fixed however long the main loop
+ * takes. Each tick:
+ *
+ *   - reads the row ports for the column driven on the previous tick,
+ *     the whole tick is the settle time so there are no delays
+ *   - releases that column and drives the next one
+ *   - after the last column, publishes the finished matrix to a ring
+ *
+ * The rows sit on ports A (A1 - A4) and C (C13), so each tick costs 2 IDR
+ * reads and the row bits are pulled out of them with a per row port index
+ * and shift, without any branches.
+ *
+ * matrix_scan_custom() only copies the newest published matrix and diffs it,
+ * debounce is still done by QMK.
+ *
+ * After MATRIX_IDLE_MS with no key down the timer is stopped, every column
+ * is driven low and the rows get falling edge interrupts, then the main
+ * loop sleeps with WFI between interrupts. A press pulls its row low, the
+ * interrupt restarts the timer and the key is seen by the next full scan.
+ */
+
+#if !defined(DIODE_DIRECTION) || DIODE_DIRECTION != ROW2COL
+#    error "matrix.c: only scans ROW2COL matrices"
+#endif
+
+// Whole matrix scans per second, the timer ticks MATRIX_COLS times as often
+#ifndef MATRIX_SCAN_HZ
+#    define MATRIX_SCAN_HZ 4000
+#endif
+
+#ifndef MATRIX_SCAN_GPT_DRIVER
+#    define MATRIX_SCAN_GPT_DRIVER GPTD2
+#endif
+
+// Time with no key down before the scan stops and waits for a row edge, 0 keeps scanning
+#ifndef MATRIX_IDLE_MS
+#    define MATRIX_IDLE_MS 500
+#endif
+
+// 1MHz timer clock, one tick per column
+#define MATRIX_SCAN_TIMER_HZ 1000000
+#define MATRIX_SCAN_TICK (MATRIX_SCAN_TIMER_HZ / (MATRIX_SCAN_HZ * MATRIX_COLS))
+
+_Static_assert(MATRIX_SCAN_TICK >= 4, "matrix.c: MATRIX_SCAN_HZ is too high, a column needs a few us to settle");
+
+// most ports the row pins can be spread over
+#define MATRIX_SCAN_MAX_PORTS MATRIX_ROWS
+
+// finished scans kept for the main loop, the timer overwrites the oldest
+#define MATRIX_SCAN_RING_SIZE 4
+
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+
+// the ports holding row pins, read once per tick
+static ioportid_t scan_ports[MATRIX_SCAN_MAX_PORTS];
+static uint8_t    scan_port_count = 0;
+
+// where each row's bit is found: which of scan_ports, and at which bit
+static uint8_t row_port[MATRIX_ROWS];
+static uint8_t row_shift[MATRIX_ROWS];
+
+// the scan in progress, only touched by the timer
+static uint8_t      scan_col = 0;
+static matrix_row_t scan_rows[MATRIX_ROWS];
+
+// finished scans, scan_seq counts them and slot (scan_seq - 1) % size is the newest
+static matrix_row_t      scan_ring[MATRIX_SCAN_RING_SIZE][MATRIX_ROWS];
+static volatile uint32_t scan_seq = 0;
+
+// set while the timer is stopped and the rows wait for an edge
+static volatile bool scan_idle        = false;
+static bool          idling           = false; // the main loop's view of scan_idle
+static uint32_t      last_active_time = 0;
+
+// columns are open drain, so they are never driven high and changing them is a single atomic write
+static inline void select_col(uint8_t col) {
+    gpio_write_pin_low(col_pins[col]);
+}
+
+static inline void unselect_col(uint8_t col) {
+    gpio_write_pin_high(col_pins[col]);
+}
+
+static void scan_tick(GPTDriver *gptp) {
+    (void)gptp;
+
+    // inverted so a pressed key (pulled low) reads as 1
+    uint32_t idr[MATRIX_SCAN_MAX_PORTS];
+    for (uint8_t port = 0; port < scan_port_count; port++) {
+        idr[port] = ~palReadPort(scan_ports[port]);
+    }
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t bit = (idr[row_port[row]] >> row_shift[row]) & 1;
+        scan_rows[row] |= bit << scan_col;
+    }
+
+    unselect_col(scan_col);
+    if (++scan_col == MATRIX_COLS) {
+        scan_col = 0;
+        memcpy(scan_ring[scan_seq % MATRIX_SCAN_RING_SIZE], scan_rows, sizeof(scan_rows));
+        memset(scan_rows, 0, sizeof(scan_rows));
+        scan_seq = scan_seq + 1;
+    }
+    select_col(scan_col);
+}
+
+static const GPTConfig scan_gpt_config = {
+    .frequency = MATRIX_SCAN_TIMER_HZ,
+    .callback  = scan_tick,
+};
+
+/**
+ * @brief Starts a fresh scan at column 0, called with the system locked.
+ */
+static void scan_start_i(void) {
+    scan_col = 0;
+    memset(scan_rows, 0, sizeof(scan_rows));
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        unselect_col(col);
+    }
+    select_col(scan_col);
+    gptStartContinuousI(&MATRIX_SCAN_GPT_DRIVER, MATRIX_SCAN_TICK);
+}
+
+#if MATRIX_IDLE_MS > 0
+/**
+ * @brief Disarms the row edges and restarts the timer, called with the system locked.
+ */
+static void scan_wake_i(void) {
+    if (scan_idle) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            palDisableLineEventI(row_pins[row]);
+        }
+        scan_idle = false;
+        scan_start_i();
+    }
+}
+
+static void row_edge(void *arg) {
+    (void)arg;
+
+    osalSysLockFromISR();
+    scan_wake_i();
+    osalSysUnlockFromISR();
+}
+
+/**
+ * @brief Stops the timer and arms the row edges, any key down then wakes the scan.
+ */
+static void scan_enter_idle(void) {
+    gptStopTimer(&MATRIX_SCAN_GPT_DRIVER);
+
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        select_col(col);
+    }
+    // same settle time as a scan tick before the rows are trusted, this can run at the slow clock during suspend
+    clock_governor_wait_us(MATRIX_SCAN_TICK);
+
+    osalSysLock();
+    scan_idle = true;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        palEnableLineEventI(row_pins[row], PAL_EVENT_MODE_FALLING_EDGE);
+        palSetLineCallbackI(row_pins[row], row_edge, NULL);
+    }
+
+    // a key that went down before the edges were armed doesn't make an edge
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (!gpio_read_pin(row_pins[row])) {
+            scan_wake_i();
+            break;
+        }
+    }
+    osalSysUnlock();
+}
+#endif
+
+void matrix_init_custom(void) {
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        unselect_col(col);
+        gpio_set_pin_output_open_drain(col_pins[col]);
+    }
+
+    scan_port_count = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        gpio_set_pin_input_high(row_pins[row]);
+
+        ioportid_t port  = PAL_PORT(row_pins[row]);
+        uint8_t    index = 0;
+        while (index < scan_port_count && scan_ports[index] != port) {
+            index++;
+        }
+        if (index == scan_port_count) {
+            scan_ports[scan_port_count++] = port;
+        }
+
+        row_port[row]  = index;
+        row_shift[row] = PAL_PAD(row_pins[row]);
+    }
+
+    gptStart(&MATRIX_SCAN_GPT_DRIVER, &scan_gpt_config);
+    osalSysLock();
+    scan_start_i();
+    osalSysUnlock();
+
+    last_active_time = timer_read32();
+}
+
+bool matrix_scan_is_idle(void) {
+    return scan_idle;
+}
+
+void matrix_scan_sleep(void) {
+#if MATRIX_IDLE_MS > 0
+    if (!idling) {
+        scan_enter_idle();
+        idling = true;
+    }
+#endif
+}
+
+bool matrix_scan_custom(matrix_row_t current_matrix[]) {
+    matrix_row_t newest[MATRIX_ROWS];
+    uint32_t     seq;
+
+#if MATRIX_IDLE_MS > 0
+    if (idling) {
+        if (scan_idle) {
+            // nothing is down, sleep until the next interrupt, a row edge, USB or the system tick
+            __WFI();
+            return false;
+        }
+        // woken by a row edge, the ring still holds the scans from before the sleep
+        idling           = false;
+        last_active_time = timer_read32();
+        return false;
+    }
+#endif
+
+    do {
+        seq = scan_seq;
+        if (seq == 0) {
+            return false; // the first scan hasn't finished yet
+        }
+        memcpy(newest, scan_ring[(seq - 1) % MATRIX_SCAN_RING_SIZE], sizeof(newest));
+        // the slot is only reused after the ring wraps, so it can't have changed unless the copy was interrupted that long
+    } while (scan_seq - seq >= MATRIX_SCAN_RING_SIZE - 1);
+
+    bool changed = memcmp(current_matrix, newest, sizeof(newest)) != 0;
+    if (changed) {
+        memcpy(current_matrix, newest, sizeof(newest));
+    }
+
+#if MATRIX_IDLE_MS > 0
+    bool any_down = false;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        any_down |= newest[row] != 0;
+    }
+    if (any_down) {
+        last_active_time = timer_read32();
+    } else if (timer_elapsed32(last_active_time) > MATRIX_IDLE_MS) {
+        scan_enter_idle();
+        idling = true;
+    }
+#endif
+
+    return changed;
+}
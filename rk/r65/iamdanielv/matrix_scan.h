@@ -0,0 +1,16 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+
+/**
+ * @brief Returns true while the scan timer is stopped and the rows wait for a key, see matrix.c.
+ */
+bool matrix_scan_is_idle(void);
+
+/**
+ * @brief Stops the scan timer now instead of after MATRIX_IDLE_MS, the next key down restarts it.
+ */
+void matrix_scan_sleep(void);
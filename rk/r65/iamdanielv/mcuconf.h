@@ -24,6 +24,13 @@
 #undef WB32_SPI_QSPI_IRQ_PRIORITY
 #define WB32_SPI_QSPI_IRQ_PRIORITY 10
 
+// Steps the matrix scan, see matrix.c
+#undef WB32_GPT_USE_TIM2
+#define WB32_GPT_USE_TIM2 TRUE
+
+#undef WB32_GPT_TIM2_IRQ_PRIORITY
+#define WB32_GPT_TIM2_IRQ_PRIORITY 7
+
 #undef WB32_SERIAL_UART3_PRIORITY
 #define WB32_SERIAL_UART3_PRIORITY 8
 
@@ -0,0 +1,200 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "report_coalesce.h"
+#include "quantum.h"
+#include "host.h"
+#include "host_driver.h"
+
+// the USB driver the reports end up in, and our stand-in for it
+static host_driver_t *downstream = NULL;
+static host_driver_t  coalesce_driver;
+
+// keyboard reports: the last one sent, and the one held until something can come between
+static report_keyboard_t keyboard_sent;
+static report_keyboard_t keyboard_held;
+static bool              keyboard_has_held = false;
+
+#ifdef NKRO_ENABLE
+static report_nkro_t nkro_sent;
+static report_nkro_t nkro_held;
+static bool          nkro_has_held = false;
+#endif
+
+// consumer and system reports, the last usage sent for each
+static report_extra_t extra_sent[2];
+static bool           extra_has_sent[2] = {false, false};
+
+static report_mouse_t mouse_sent;
+static bool           mouse_has_sent = false;
+
+/**
+ * @brief Sets a bit for every key down in a 6KRO report, 8 words of keys then the mods.
+ */
+static void keyboard_bits(const report_keyboard_t *report, uint32_t bits[9]) {
+    memset(bits, 0, 9 * sizeof(uint32_t));
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t key = report->keys[i];
+        bits[key >> 5] |= 1UL << (key & 31);
+    }
+    bits[0] &= ~1UL; // KC_NO is an empty slot
+    bits[8] = report->mods;
+}
+
+/**
+ * @brief Returns true if going sent -> held -> next changes no key or modifier twice.
+ */
+static bool keyboard_can_merge(const report_keyboard_t *next) {
+    uint32_t sent[9], held[9], after[9];
+    keyboard_bits(&keyboard_sent, sent);
+    keyboard_bits(&keyboard_held, held);
+    keyboard_bits(next, after);
+
+    for (uint8_t i = 0; i < 9; i++) {
+        if ((sent[i] ^ held[i]) & (held[i] ^ after[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void keyboard_flush(void) {
+    if (keyboard_has_held) {
+        keyboard_has_held = false;
+        keyboard_sent     = keyboard_held;
+        downstream->send_keyboard(&keyboard_sent);
+    }
+}
+
+#ifdef NKRO_ENABLE
+/**
+ * @brief Same as keyboard_can_merge(), the NKRO report already is one bit per key and modifier.
+ */
+static bool nkro_can_merge(const report_nkro_t *next) {
+    const uint8_t *sent  = (const uint8_t *)&nkro_sent;
+    const uint8_t *held  = (const uint8_t *)&nkro_held;
+    const uint8_t *after = (const uint8_t *)next;
+
+    for (uint8_t i = 0; i < sizeof(report_nkro_t); i++) {
+        if ((sent[i] ^ held[i]) & (held[i] ^ after[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void nkro_flush(void) {
+    if (nkro_has_held) {
+        nkro_has_held = false;
+        nkro_sent     = nkro_held;
+        downstream->send_nkro(&nkro_sent);
+    }
+}
+#endif
+
+/**
+ * @brief Sends the held keyboard reports, so nothing after them can overtake them or close a gap.
+ */
+static void flush_held(void) {
+    keyboard_flush();
+#ifdef NKRO_ENABLE
+    nkro_flush();
+#endif
+}
+
+static void send_keyboard(report_keyboard_t *report) {
+#ifdef NKRO_ENABLE
+    nkro_flush(); // NKRO was just toggled off
+#endif
+    const report_keyboard_t *latest = keyboard_has_held ? &keyboard_held : &keyboard_sent;
+    if (memcmp(report, latest, sizeof(*report)) == 0) {
+        return; // nothing changed
+    }
+
+    if (keyboard_has_held && !keyboard_can_merge(report)) {
+        // something changes back, the held report must go out first
+        keyboard_flush();
+    }
+    keyboard_held     = *report;
+    keyboard_has_held = true;
+}
+
+#ifdef NKRO_ENABLE
+static void send_nkro(report_nkro_t *report) {
+    keyboard_flush();
+    const report_nkro_t *latest = nkro_has_held ? &nkro_held : &nkro_sent;
+    if (memcmp(report, latest, sizeof(*report)) == 0) {
+        return;
+    }
+
+    if (nkro_has_held && !nkro_can_merge(report)) {
+        nkro_flush();
+    }
+    nkro_held     = *report;
+    nkro_has_held = true;
+}
+#endif
+
+static void send_mouse(report_mouse_t *report) {
+    // movement is relative, only a repeat of the same buttons without any movement is a no-op
+    bool still = report->x == 0 && report->y == 0 && report->v == 0 && report->h == 0;
+    if (still && mouse_has_sent && memcmp(report, &mouse_sent, sizeof(*report)) == 0) {
+        return;
+    }
+
+    // a click has to land after the modifiers held with it
+    flush_held();
+    mouse_sent     = *report;
+    mouse_has_sent = true;
+    downstream->send_mouse(report);
+}
+
+static void send_extra(report_extra_t *report) {
+    uint8_t kind = report->report_id == REPORT_ID_CONSUMER ? 1 : 0;
+    if (extra_has_sent[kind] && extra_sent[kind].usage == report->usage) {
+        return;
+    }
+
+    flush_held();
+    extra_sent[kind]     = *report;
+    extra_has_sent[kind] = true;
+    downstream->send_extra(report);
+}
+
+/**
+ * @brief wait_ms() lands here, the linker sends every chThdSleep call through it (see rules.mk).
+ *
+ * The held report goes out before the wait, so the gap tap_code() and friends
+ * leave between press and release still reaches the host.
+ */
+void __real_chThdSleep(sysinterval_t time);
+void __wrap_chThdSleep(sysinterval_t time) {
+    flush_held();
+    __real_chThdSleep(time);
+}
+
+void report_coalesce_task(void) {
+    host_driver_t *driver = host_get_driver();
+    if (driver == NULL) {
+        return; // USB isn't set up yet
+    }
+
+    if (driver != &coalesce_driver) {
+        // QMK sets the driver after keyboard_post_init, so take it over on the first pass
+        flush_held();
+        downstream      = driver;
+        coalesce_driver = *driver;
+
+        coalesce_driver.send_keyboard = send_keyboard;
+#ifdef NKRO_ENABLE
+        coalesce_driver.send_nkro = send_nkro;
+#endif
+        coalesce_driver.send_mouse = send_mouse;
+        coalesce_driver.send_extra = send_extra;
+        host_set_driver(&coalesce_driver);
+        return;
+    }
+
+    // the end of the pass, whatever was merged goes out before the next scan
+    flush_held();
+}
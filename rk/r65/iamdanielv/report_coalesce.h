@@ -0,0 +1,31 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/**
+ * Sits between QMK and the USB host driver, drops the reports that change
+ * nothing and merges keyboard reports that are queued back to back.
+ *
+ * A report equal to the last one sent of its kind is dropped, for the
+ * keyboard (6KRO and NKRO), consumer / system and mouse reports. Mouse
+ * reports with movement always go out, the movement is relative.
+ *
+ * A keyboard report is held, and the next one replaces it as long as no key
+ * or modifier changes twice, so handle_backspace's shift release and Del
+ * press go out as one report. A bit that would change back sends the held
+ * report first, every transition still reaches the host in order.
+ *
+ * The held report goes out before anything can come between it and the next:
+ *   - the first wait_ms(), tap_code() and friends time their gaps with it
+ *     (chThdSleep is wrapped at link time, see rules.mk)
+ *   - any mouse, consumer or system report, a click never overtakes its modifier
+ *   - the end of the main loop pass, from report_coalesce_task()
+ */
+
+/**
+ * @brief Installs the filter once QMK has set up the host driver, and sends the held report.
+ *
+ * Call this from `housekeeping_task_kb`, which runs once per main loop pass.
+ */
+void report_coalesce_task(void);
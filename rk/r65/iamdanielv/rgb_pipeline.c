@@ -0,0 +1,350 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_pipeline.h"
+#include "quantum.h"
+#include "ws2812.h"
+#include "ws2812_compact.h"
+#include "cycles.h"
+#include "clock_governor.h"
+
+// what the effects and indicators have drawn
+static rgb_t rgb_frame[RGB_MATRIX_LED_COUNT];
+
+// rgb_frame as it was at the last two flushes, effects render over several passes so rgb_frame can be half done
+static rgb_t   flushed_frames[2][RGB_MATRIX_LED_COUNT];
+static uint8_t flushed_newest = 0;
+
+// LEDs written by the indicators this frame, they are shown as is and skip the crossfade
+#define OVERLAY_WORDS ((RGB_MATRIX_LED_COUNT + 31) / 32)
+static uint32_t overlay_mask[OVERLAY_WORDS];
+static bool     overlay_drawing = false;
+
+// the frozen outgoing frame while a crossfade is running, and its channel totals
+static rgb_t    crossfade_snapshot[RGB_MATRIX_LED_COUNT];
+static uint32_t snapshot_sum[3]   = {0};
+static bool     crossfade_running = false;
+static uint32_t crossfade_timer   = 0;
+
+// set when an LED changes, the strip is only re-sent when something changed
+static bool     frame_dirty      = true;
+static uint32_t last_send_time   = 0;
+static uint32_t last_change_time = 0;
+
+// when the effect wrote its LEDs, read back by rgb_pipeline_take_writes()
+static rgb_pipeline_writes_t writes = {0};
+
+// running channel totals of rgb_frame, kept up to date by set_color
+static uint32_t channel_sum[3] = {0};
+
+// the LED rail is cut while the frame stays black, see rgb_pipeline_led_power()
+static bool     led_power_on  = true;
+static uint32_t power_on_time = 0;
+static bool     frame_black   = false;
+static uint32_t black_since   = 0;
+
+// while suspended the SPI peripheral is stopped and the rail is off, rgb_frame is kept as it was
+static bool pipeline_suspended = false;
+
+// while held, flushes are only counted and the LEDs are left alone
+static bool     pipeline_held = false;
+static uint32_t frame_count   = 0;
+
+// the frame on the LEDs, as far as the effect and indicators go
+static inline rgb_t *shown_frame(void) {
+    return flushed_frames[flushed_newest];
+}
+
+static inline uint8_t mix8(uint8_t from, uint8_t to, uint16_t alpha) {
+    // alpha is 0 - 256, 256 means fully `to`
+    return (uint8_t)(((uint16_t)from * (256 - alpha) + (uint16_t)to * alpha) >> 8);
+}
+
+static uint16_t crossfade_alpha(void) {
+    uint32_t elapsed = timer_elapsed32(crossfade_timer);
+    if (elapsed >= RGB_CROSSFADE_MS) {
+        crossfade_running = false;
+        return 256;
+    }
+    return (uint16_t)((elapsed * 256) / RGB_CROSSFADE_MS);
+}
+
+void rgb_pipeline_crossfade_start(void) {
+    const rgb_t *shown = shown_frame();
+    // fold the fade in progress into the snapshot so we start from what is showing
+    uint16_t alpha = crossfade_running ? crossfade_alpha() : 256;
+    snapshot_sum[0] = snapshot_sum[1] = snapshot_sum[2] = 0;
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        crossfade_snapshot[i].r = mix8(crossfade_snapshot[i].r, shown[i].r, alpha);
+        crossfade_snapshot[i].g = mix8(crossfade_snapshot[i].g, shown[i].g, alpha);
+        crossfade_snapshot[i].b = mix8(crossfade_snapshot[i].b, shown[i].b, alpha);
+        snapshot_sum[0] += crossfade_snapshot[i].r;
+        snapshot_sum[1] += crossfade_snapshot[i].g;
+        snapshot_sum[2] += crossfade_snapshot[i].b;
+    }
+
+    crossfade_timer   = timer_read32();
+    crossfade_running = true;
+}
+
+bool rgb_pipeline_crossfade_active(void) {
+    return crossfade_running;
+}
+
+void rgb_pipeline_overlay(bool drawing) {
+    overlay_drawing = drawing;
+}
+
+void rgb_pipeline_hold(bool hold) {
+    pipeline_held = hold;
+}
+
+uint32_t rgb_pipeline_frame_count(void) {
+    return frame_count;
+}
+
+const rgb_t *rgb_pipeline_frame(void) {
+    return rgb_frame;
+}
+
+uint32_t rgb_pipeline_unchanged_ms(void) {
+    return timer_elapsed32(last_change_time);
+}
+
+void rgb_pipeline_take_writes(rgb_pipeline_writes_t *out) {
+    *out         = writes;
+    writes.count = 0;
+}
+
+void rgb_pipeline_led_power(bool on) {
+#ifdef LED_ENABLE_PIN
+    if (on) {
+        gpio_write_pin_high(LED_ENABLE_PIN);
+        power_on_time = timer_read32();
+        frame_dirty   = true; // the LEDs lost their colors
+    } else {
+        gpio_write_pin_low(LED_ENABLE_PIN);
+    }
+    led_power_on = on;
+#endif
+}
+
+/**
+ * @brief Cuts the LED rail once the frame has been black for a while.
+ *
+ * @return True if the LEDs can't take a frame right now, either because they
+ *         are off or because the rail is still settling.
+ */
+static bool led_power_gate(void) {
+    if (channel_sum[0] == 0 && channel_sum[1] == 0 && channel_sum[2] == 0 && !crossfade_running) {
+        if (!frame_black) {
+            frame_black = true;
+            black_since = timer_read32();
+        } else if (led_power_on && timer_elapsed32(black_since) >= RGB_BLACK_POWER_OFF_MS) {
+            rgb_pipeline_led_power(false);
+        }
+        return !led_power_on;
+    }
+
+    frame_black = false;
+    if (!led_power_on) {
+        rgb_pipeline_led_power(true);
+    }
+    return timer_elapsed32(power_on_time) < RGB_POWER_ON_SETTLE_MS;
+}
+
+static void rgb_pipeline_init(void) {
+    cycles_enable();
+    ws2812_init();
+}
+
+static void rgb_pipeline_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    uint32_t now = cycles_read();
+    if (!writes.count) {
+        writes.first = now;
+    }
+    writes.last = now;
+    writes.count++;
+
+    if (overlay_drawing) {
+        overlay_mask[index / 32] |= 1UL << (index % 32);
+    }
+
+    if (rgb_frame[index].r == red && rgb_frame[index].g == green && rgb_frame[index].b == blue) {
+        return;
+    }
+    frame_dirty = true;
+    channel_sum[0] += red - rgb_frame[index].r;
+    channel_sum[1] += green - rgb_frame[index].g;
+    channel_sum[2] += blue - rgb_frame[index].b;
+    rgb_frame[index].r = red;
+    rgb_frame[index].g = green;
+    rgb_frame[index].b = blue;
+}
+
+static void rgb_pipeline_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_pipeline_set_color(i, red, green, blue);
+    }
+}
+
+#if RGB_POWER_BUDGET_MA > 0
+#    define RGB_POWER_IDLE_TOTAL_MA (RGB_POWER_IDLE_MA * RGB_MATRIX_LED_COUNT)
+_Static_assert(RGB_POWER_BUDGET_MA > RGB_POWER_IDLE_TOTAL_MA, "RGB_POWER_BUDGET_MA must be more than the idle draw of the LEDs");
+
+/**
+ * @brief Returns the scale (0 - 256) that keeps a frame with these channel totals within RGB_POWER_BUDGET_MA.
+ */
+static uint16_t power_scale(const uint32_t sum[3]) {
+    uint32_t lit_ma = (sum[0] * RGB_POWER_RED_MA + sum[1] * RGB_POWER_GREEN_MA + sum[2] * RGB_POWER_BLUE_MA) / 255;
+    if (lit_ma + RGB_POWER_IDLE_TOTAL_MA <= RGB_POWER_BUDGET_MA) {
+        return 256;
+    }
+    return ((RGB_POWER_BUDGET_MA - RGB_POWER_IDLE_TOTAL_MA) * 256) / lit_ma;
+}
+#else
+static inline uint16_t power_scale(const uint32_t sum[3]) {
+    (void)sum;
+    return 256;
+}
+#endif
+
+static inline bool is_overlay(uint8_t index) {
+    return overlay_mask[index / 32] & (1UL << (index % 32));
+}
+
+/**
+ * @brief Works out the channel totals of the crossfaded frame without mixing it.
+ *
+ * The mix can be brighter than rgb_frame, fading out of white for one, so the
+ * power limit can't go by channel_sum. The totals are mixed from snapshot_sum
+ * and channel_sum instead, only the overlay LEDs are visited since they skip
+ * the mix. Flooring the totals once never gives less than the sum of the
+ * floored LEDs, so the limit errs on the safe side.
+ */
+static void crossfade_sum(uint16_t alpha, uint32_t sum[3]) {
+    uint32_t snapshot[3] = {snapshot_sum[0], snapshot_sum[1], snapshot_sum[2]};
+    uint32_t overlay[3]  = {0};
+    for (uint8_t word = 0; word < OVERLAY_WORDS; word++) {
+        for (uint32_t bits = overlay_mask[word]; bits; bits &= bits - 1) {
+            uint8_t i = word * 32 + __builtin_ctzl(bits);
+            snapshot[0] -= crossfade_snapshot[i].r;
+            snapshot[1] -= crossfade_snapshot[i].g;
+            snapshot[2] -= crossfade_snapshot[i].b;
+            overlay[0] += rgb_frame[i].r;
+            overlay[1] += rgb_frame[i].g;
+            overlay[2] += rgb_frame[i].b;
+        }
+    }
+    for (uint8_t c = 0; c < 3; c++) {
+        sum[c] = ((snapshot[c] * (256 - alpha) + (channel_sum[c] - overlay[c]) * alpha) >> 8) + overlay[c];
+    }
+}
+
+/**
+ * @brief Mixes in the crossfade, applies the power limit and sends the frame, in one pass over the LEDs.
+ */
+static void send_frame(void) {
+    frame_dirty    = false;
+    last_send_time = timer_read32();
+
+    uint32_t sum[3] = {channel_sum[0], channel_sum[1], channel_sum[2]};
+    uint16_t alpha  = crossfade_running ? crossfade_alpha() : 256;
+    if (alpha < 256) {
+        crossfade_sum(alpha, sum);
+    }
+
+    uint16_t scale = power_scale(sum);
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_t rgb = rgb_frame[i];
+        if (alpha < 256 && !is_overlay(i)) {
+            rgb.r = mix8(crossfade_snapshot[i].r, rgb.r, alpha);
+            rgb.g = mix8(crossfade_snapshot[i].g, rgb.g, alpha);
+            rgb.b = mix8(crossfade_snapshot[i].b, rgb.b, alpha);
+        }
+        if (scale < 256) {
+            rgb.r = (rgb.r * scale) >> 8;
+            rgb.g = (rgb.g * scale) >> 8;
+            rgb.b = (rgb.b * scale) >> 8;
+        }
+        ws2812_set_color(i, rgb.r, rgb.g, rgb.b);
+    }
+
+    ws2812_flush();
+}
+
+/**
+ * @brief Sends the frame if it has to go out, the frame is complete at this point.
+ */
+static void flush_frame(void) {
+    if (pipeline_held || pipeline_suspended || led_power_gate()) {
+        return;
+    }
+
+    if (frame_dirty || crossfade_running) {
+        last_change_time = timer_read32();
+    }
+
+    // an unchanged frame is skipped, but still re-sent now and then in case the strip glitched
+    if (!frame_dirty && !crossfade_running && timer_elapsed32(last_send_time) < RGB_PIPELINE_REFRESH_MS) {
+        return;
+    }
+    send_frame();
+}
+
+static void rgb_pipeline_flush(void) {
+    frame_count++;
+    flush_frame();
+
+    // the next crossfade starts from this frame, and the indicators mark their LEDs again
+    flushed_newest ^= 1;
+    memcpy(shown_frame(), rgb_frame, sizeof(rgb_frame));
+    memset(overlay_mask, 0, sizeof(overlay_mask));
+}
+
+void rgb_pipeline_suspend(void) {
+    if (pipeline_suspended) {
+        return;
+    }
+    pipeline_suspended = true;
+
+#ifdef RGB_MATRIX_SLEEP
+    // QMK has just rendered and flushed a black frame for the suspend, keep the one before it for the wakeup
+    const rgb_t *kept = flushed_frames[flushed_newest ^ 1];
+    channel_sum[0] = channel_sum[1] = channel_sum[2] = 0;
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_frame[i] = kept[i];
+        channel_sum[0] += kept[i].r;
+        channel_sum[1] += kept[i].g;
+        channel_sum[2] += kept[i].b;
+    }
+    frame_dirty = true;
+#endif
+
+    rgb_pipeline_led_power(false);
+    ws2812_stop();
+}
+
+void rgb_pipeline_resume(void) {
+    if (!pipeline_suspended) {
+        return;
+    }
+    pipeline_suspended = false;
+    ws2812_start();
+
+    // put the last frame straight back, the effect carries on from it on its next render
+    if (channel_sum[0] || channel_sum[1] || channel_sum[2]) {
+        // the settle wait and the transfer are timed for the full clock
+        clock_governor_boost();
+        rgb_pipeline_led_power(true);
+        wait_ms(RGB_POWER_ON_SETTLE_MS);
+        send_frame();
+    }
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = rgb_pipeline_init,
+    .flush         = rgb_pipeline_flush,
+    .set_color     = rgb_pipeline_set_color,
+    .set_color_all = rgb_pipeline_set_color_all,
+};
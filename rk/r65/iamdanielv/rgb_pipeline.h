@@ -0,0 +1,144 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "color.h"
+
+// How long a crossfade between two effects or palettes lasts
+#ifndef RGB_CROSSFADE_MS
+#    define RGB_CROSSFADE_MS 400
+#endif
+
+// How often an unchanged frame is sent again anyway
+#ifndef RGB_PIPELINE_REFRESH_MS
+#    define RGB_PIPELINE_REFRESH_MS 1000
+#endif
+
+// Current the LEDs may draw, the frame is dimmed to fit. 0 turns the limiter off.
+#ifndef RGB_POWER_BUDGET_MA
+#    define RGB_POWER_BUDGET_MA 0
+#endif
+
+// Current model of one LED: mA per channel at full brightness, and when dark
+#ifndef RGB_POWER_RED_MA
+#    define RGB_POWER_RED_MA 12
+#endif
+#ifndef RGB_POWER_GREEN_MA
+#    define RGB_POWER_GREEN_MA 12
+#endif
+#ifndef RGB_POWER_BLUE_MA
+#    define RGB_POWER_BLUE_MA 12
+#endif
+#ifndef RGB_POWER_IDLE_MA
+#    define RGB_POWER_IDLE_MA 1
+#endif
+
+// How long the frame must stay black before LED_ENABLE_PIN cuts the LED rail
+#ifndef RGB_BLACK_POWER_OFF_MS
+#    define RGB_BLACK_POWER_OFF_MS 3000
+#endif
+
+// How long the LEDs get to power up before the first frame is sent to them
+#ifndef RGB_POWER_ON_SETTLE_MS
+#    define RGB_POWER_ON_SETTLE_MS 5
+#endif
+
+/**
+ * The RGB matrix uses a custom driver (see keyboard.json) so every frame passes
+ * through here before it is handed to the WS2812 driver:
+ *
+ *   effect + indicators -> rgb_frame -> [crossfade] -> [power limit] -> ws2812 flush
+ *
+ * set_color only marks the frame dirty when an LED actually changes, so static
+ * effects and idle indicator frames skip the SPI transfer entirely. It also
+ * keeps running channel totals, so the power limit is one global scale worked
+ * out from three sums and applied while the frame is copied out. During a
+ * crossfade, which can be brighter than rgb_frame, the totals are mixed from
+ * these and the totals of the snapshot, and each LED is mixed as it is copied
+ * out, so there is still one pass and no second frame. The same sums show
+ * when the frame is all black, and if it stays black the LED rail is cut
+ * until something lights up again.
+ */
+
+/**
+ * @brief Starts a crossfade from what is currently on the LEDs.
+ *
+ * The last complete frame is frozen into a snapshot, so only the incoming effect
+ * keeps rendering and each flush mixes the two with a fixed-point alpha.
+ * LEDs drawn by the indicators (see rgb_pipeline_overlay) are not faded.
+ * Call this right before changing the effect, palette or colors.
+ */
+void rgb_pipeline_crossfade_start(void);
+
+/**
+ * @brief Returns true while a crossfade is being mixed in.
+ */
+bool rgb_pipeline_crossfade_active(void);
+
+/**
+ * @brief Marks the LEDs written between overlay(true) and overlay(false) as indicators.
+ *
+ * Indicator LEDs are shown as drawn during a crossfade, so layer and lock
+ * indicators appear at once while the effect underneath fades.
+ */
+void rgb_pipeline_overlay(bool drawing);
+
+/**
+ * @brief Stops (or resumes) sending frames to the LEDs.
+ *
+ * While held, each flush only bumps the frame counter, so the effects can be
+ * rendered and inspected without paying for the WS2812 transfer.
+ */
+void rgb_pipeline_hold(bool hold);
+
+/**
+ * @brief Returns the number of frames flushed so far, wraps around.
+ */
+uint32_t rgb_pipeline_frame_count(void);
+
+/**
+ * @brief Returns the frame as drawn by the effect and indicators, before any crossfade.
+ */
+const rgb_t *rgb_pipeline_frame(void);
+
+/**
+ * @brief Returns how long the frame has stayed the same, in ms.
+ */
+uint32_t rgb_pipeline_unchanged_ms(void);
+
+typedef struct {
+    uint32_t first; // cycle count at the first write
+    uint32_t last;  // cycle count at the last write
+    uint16_t count; // number of set_color calls
+} rgb_pipeline_writes_t;
+
+/**
+ * @brief Returns the set_color calls since the last call and starts counting again.
+ *
+ * The spacing of the writes tells how long an effect takes per LED.
+ */
+void rgb_pipeline_take_writes(rgb_pipeline_writes_t *out);
+
+/**
+ * @brief Switches the LED rail (LED_ENABLE_PIN) on or off.
+ *
+ * Turning it on re-sends the frame once the LEDs have settled.
+ */
+void rgb_pipeline_led_power(bool on);
+
+/**
+ * @brief Cuts the LED rail and stops the WS2812 SPI peripheral, for USB suspend.
+ *
+ * The frame is kept, nothing is sent until rgb_pipeline_resume(). With
+ * RGB_MATRIX_SLEEP QMK flushes a black frame right before this is called,
+ * so the frame flushed before that one is kept instead.
+ */
+void rgb_pipeline_suspend(void);
+
+/**
+ * @brief Restarts the SPI peripheral and shows the frame from before the suspend right away.
+ */
+void rgb_pipeline_resume(void);
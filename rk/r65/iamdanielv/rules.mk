@@ -0,0 +1,25 @@
+# The RGB matrix uses a custom driver that feeds the WS2812 driver, see rgb_pipeline.c
+WS2812_DRIVER_REQUIRED = yes
+SRC += rgb_pipeline.c
+
+# WS2812 over SPI with a compact bit encoding, see ws2812_compact.c
+SRC += ws2812_compact.c
+
+# Timer driven matrix scan that reads whole GPIO ports, see matrix.c
+CUSTOM_MATRIX = lite
+SRC += matrix.c
+
+# Eager on press, deferred on release per key debounce, see debounce_eager.c
+DEBOUNCE_TYPE = custom
+SRC += debounce_eager.c
+
+# Slows the core while idle, see clock_governor.c
+SRC += clock_governor.c
+
+# Encoder decoded from pin edges, see encoder_isr.c
+SRC += encoder_isr.c
+
+# Drops repeated HID reports and merges back to back keyboard reports, see report_coalesce.c
+# wait_ms() sends the held report first, every chThdSleep call goes through report_coalesce.c
+SRC += report_coalesce.c
+EXTRALDFLAGS += -Wl,--wrap=chThdSleep
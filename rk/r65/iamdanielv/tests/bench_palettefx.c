@@ -0,0 +1,160 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/**
+ * Renders the PaletteFx effects on the host: features/palettefx.inc is built
+ * against the lib8tion and rgb_matrix stand-ins in stubs/, with the LED layout
+ * generated from keyboard.json and the keyboard's HSV conversion from
+ * features/fast_hsv.c.
+ *
+ *   bench_palettefx [frames]       64 frames when left out
+ *
+ * Every effect is rendered at every speed the speed keys reach, N frames each,
+ * the way features/effect_bench.c does it on the keyboard: the effect clock
+ * advances EFFECT_BENCH_FRAME_MS per frame from the same time base, the random
+ * seed is reset per run, and the frames are chained into one FNV-1a checksum.
+ * An optimisation that renders the same frames keeps every checksum.
+ *
+ * The cost is host time, good for comparing builds on the same machine, not
+ * for the keyboard's budget. On x86 the time stamp counter gives cycles too.
+ * tools/bench_sweep.py measures the real cycles on the keyboard.
+ *
+ * The reactive effect needs key hits and is left out.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "led_index_tables.h"
+
+#define RGB_MATRIX_LED_COUNT LED_TABLES_LED_COUNT
+#define PALETTEFX_ENABLE_ALL_EFFECTS
+#define PALETTEFX_ENABLE_ALL_PALETTES
+
+#include "quantum.h"
+#include "lib/lib8tion/lib8tion.h"
+#include "effect_bench.h"
+
+#ifndef RGB_MATRIX_SPD_STEP
+#    define RGB_MATRIX_SPD_STEP 16
+#endif
+
+// the same time base and checksum as features/effect_bench.c
+#define BENCH_TIME_BASE 0x80000000UL
+#define FNV_OFFSET 2166136261UL
+#define FNV_PRIME 16777619UL
+
+led_config_t g_led_config = {LED_TABLES_POINTS, LED_TABLES_FLAGS};
+led_point_t  k_rgb_matrix_center = LED_TABLES_CENTER;
+rgb_config_t rgb_matrix_config   = {.enable = 1, .hsv = {0, 255, 255}, .speed = 128, .flags = LED_FLAG_ALL};
+uint32_t     g_rgb_timer         = 0;
+
+static rgb_t frame[RGB_MATRIX_LED_COUNT];
+
+void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    frame[index] = (rgb_t){red, green, blue};
+}
+uint8_t rgb_matrix_get_hue(void) {
+    return rgb_matrix_config.hsv.h;
+}
+hsv_t rgb_matrix_get_hsv(void) {
+    return rgb_matrix_config.hsv;
+}
+void rgb_matrix_sethsv_noeeprom(uint16_t hue, uint8_t sat, uint8_t val) {
+    rgb_matrix_config.hsv = (hsv_t){hue, sat, val};
+}
+
+// the effects, then a table of them from the same list QMK builds its modes from
+#define RGB_MATRIX_EFFECT_CLASS(name, effect_class)
+#define RGB_MATRIX_EFFECT(name)
+#define RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+#include "palettefx.inc"
+#undef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+#undef RGB_MATRIX_EFFECT
+
+typedef struct {
+    const char *name;
+    bool (*render)(effect_params_t *params);
+} effect_t;
+
+#define RGB_MATRIX_EFFECT(name) {#name, name},
+static const effect_t effects[] = {
+#include "palettefx.inc"
+};
+#undef RGB_MATRIX_EFFECT
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint64_t now_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static uint32_t frame_checksum(uint32_t hash) {
+    const uint8_t *bytes = (const uint8_t *)frame;
+    for (uint16_t i = 0; i < sizeof(frame); i++) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * @brief Renders `frames` frames of an effect at one speed and prints a CSV row.
+ */
+static void bench(const effect_t *effect, uint8_t speed, uint16_t frames) {
+    rgb_matrix_config.speed = speed;
+    random16_set_seed(EFFECT_BENCH_SEED);
+    srand(EFFECT_BENCH_SEED);
+    memset(frame, 0, sizeof(frame));
+
+    uint64_t ns = 0, cycles = 0, worst_ns = 0;
+    uint32_t checksum = FNV_OFFSET;
+    for (uint16_t f = 0; f < frames; f++) {
+        effect_params_t params = {.iter = 0, .flags = rgb_matrix_config.flags, .init = f == 0};
+        g_rgb_timer            = BENCH_TIME_BASE + (uint32_t)f * EFFECT_BENCH_FRAME_MS;
+
+        uint64_t start_ns     = now_ns();
+        uint64_t start_cycles = now_cycles();
+        // like rgb_matrix_task(), the effect says when the frame is done
+        while (effect->render(&params)) {
+            params.iter++;
+        }
+        uint64_t frame_ns = now_ns() - start_ns;
+        cycles += now_cycles() - start_cycles;
+
+        ns += frame_ns;
+        if (frame_ns > worst_ns) {
+            worst_ns = frame_ns;
+        }
+        checksum = frame_checksum(checksum);
+    }
+
+    printf("%s,%u,%u,%.0f,%llu,%.1f,%.0f,%.0f,%08x\n", effect->name, speed, frames, (double)ns / frames, (unsigned long long)worst_ns, (double)ns / frames / RGB_MATRIX_LED_COUNT, (double)cycles / frames, (double)cycles / frames / RGB_MATRIX_LED_COUNT, checksum);
+}
+
+int main(int argc, char **argv) {
+    uint16_t frames = argc > 1 ? atoi(argv[1]) : EFFECT_BENCH_DEFAULT_FRAMES;
+    if (frames == 0) {
+        fprintf(stderr, "usage: %s [frames]\n", argv[0]);
+        return 1;
+    }
+
+    printf("effect,speed,frames,ns_per_frame,worst_ns,ns_per_led,cycles_per_frame,cycles_per_led,checksum\n");
+    for (size_t e = 0; e < sizeof(effects) / sizeof(effects[0]); e++) {
+        // 0, RGB_MATRIX_SPD_STEP, ... and 255, where the speed keys stop
+        for (uint16_t speed = 0;; speed += RGB_MATRIX_SPD_STEP) {
+            bench(&effects[e], speed < 255 ? speed : 255, frames);
+            if (speed >= 255) {
+                break;
+            }
+        }
+    }
+    return 0;
+}
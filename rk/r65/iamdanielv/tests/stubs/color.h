@@ -0,0 +1,23 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Stand-in for QMK's color.h, the same layout so it links against QMK's color.c
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+} rgb_t;
+
+typedef struct {
+    uint8_t h;
+    uint8_t s;
+    uint8_t v;
+} hsv_t;
+
+rgb_t hsv_to_rgb(hsv_t hsv);
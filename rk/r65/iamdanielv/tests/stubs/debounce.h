@@ -0,0 +1,15 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Stand-in for QMK's debounce.h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "matrix.h"
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed);
+void debounce_init(uint8_t num_rows);
+void debounce_free(void);
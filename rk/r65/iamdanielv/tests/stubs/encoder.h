@@ -0,0 +1,18 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Stand-in for QMK's encoder.h, the tests set NUM_ENCODERS and the pins
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef MAX_QUEUED_ENCODER_EVENTS
+#    define MAX_QUEUED_ENCODER_EVENTS 5
+#endif
+
+#define ENCODER_CLOCKWISE true
+#define ENCODER_COUNTER_CLOCKWISE false
+
+void encoder_queue_event(uint8_t index, bool clockwise);
@@ -0,0 +1,76 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Stand-in for the ChibiOS HAL, types and prototypes only, each test defines the calls it makes
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define TRUE 1
+#define FALSE 0
+
+typedef uint32_t ioline_t;
+typedef uint32_t ioportid_t;
+typedef uint32_t iomode_t;
+
+#define PAL_PORT(line) ((ioportid_t)((line) >> 4))
+#define PAL_PAD(line) ((line)&0xF)
+#define PAL_MODE_ALTERNATE(n) ((iomode_t)(n) << 8)
+#define PAL_MODE_OUTPUT_PUSHPULL 0x01
+#define PAL_OUTPUT_TYPE_PUSHPULL 0x00
+#define PAL_OUTPUT_SPEED_HIGHEST 0x10
+
+void palSetLineMode(ioline_t line, iomode_t mode);
+void palClearLine(ioline_t line);
+uint8_t palReadLine(ioline_t line);
+
+// PAL line events
+#define PAL_EVENT_MODE_BOTH_EDGES 3
+
+typedef void (*palcallback_t)(void *arg);
+
+void palEnableLineEvent(ioline_t line, uint32_t mode);
+void palSetLineCallback(ioline_t line, palcallback_t cb, void *arg);
+
+// threads, wait_ms() is a thread sleep
+typedef uint32_t sysinterval_t;
+
+void chThdSleep(sysinterval_t time);
+
+// OSAL critical sections
+void osalSysLock(void);
+void osalSysUnlock(void);
+void osalSysLockFromISR(void);
+void osalSysUnlockFromISR(void);
+
+// SPI
+#define SPI_SUPPORTS_CIRCULAR FALSE
+
+typedef enum { SPI_STOP, SPI_READY, SPI_ACTIVE } spistate_t;
+
+typedef struct {
+    void      *end_cb;
+    ioportid_t ssport;
+    uint16_t   sspad;
+    uint32_t   spi_mode;
+    uint32_t   spi_lsbfirst;
+    uint32_t   spi_divisor;
+} SPIConfig;
+
+typedef struct {
+    spistate_t state;
+} SPIDriver;
+
+extern SPIDriver SPID1;
+
+void spiAcquireBus(SPIDriver *spip);
+void spiReleaseBus(SPIDriver *spip);
+void spiStart(SPIDriver *spip, const SPIConfig *config);
+void spiStop(SPIDriver *spip);
+void spiSelect(SPIDriver *spip);
+void spiUnselect(SPIDriver *spip);
+void spiSend(SPIDriver *spip, size_t n, const void *txbuf);
+void spiStartSend(SPIDriver *spip, size_t n, const void *txbuf);
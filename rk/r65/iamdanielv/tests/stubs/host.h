@@ -0,0 +1,11 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Stand-in for QMK's host.h, each test defines the calls it makes
+
+#include "host_driver.h"
+
+void           host_set_driver(host_driver_t *driver);
+host_driver_t *host_get_driver(void);
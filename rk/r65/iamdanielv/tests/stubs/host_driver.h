@@ -0,0 +1,16 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Stand-in for QMK's host_driver.h
+
+#include "report.h"
+
+typedef struct {
+    uint8_t (*keyboard_leds)(void);
+    void (*send_keyboard)(report_keyboard_t *);
+    void (*send_nkro)(report_nkro_t *);
+    void (*send_mouse)(report_mouse_t *);
+    void (*send_extra)(report_extra_t *);
+} host_driver_t;
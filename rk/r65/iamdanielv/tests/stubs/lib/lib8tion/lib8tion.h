@@ -0,0 +1,135 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Stand-in for QMK's lib8tion, the functions the effects call. Each one is the
+// portable C path QMK builds for ARM, with FASTLED_SCALE8_FIXED, so the effects
+// render the same values they do on the keyboard.
+
+#include <stdint.h>
+
+typedef uint8_t fract8;
+
+static inline uint8_t scale8(uint8_t i, fract8 scale) {
+    return (((uint16_t)i) * (1 + (uint16_t)(scale))) >> 8;
+}
+
+static inline uint16_t scale16by8(uint16_t i, fract8 scale) {
+    return (i * (1 + ((uint16_t)scale))) >> 8;
+}
+
+static inline uint8_t qadd8(uint8_t i, uint8_t j) {
+    unsigned int t = i + j;
+    return t > 255 ? 255 : t;
+}
+
+static inline uint8_t abs8(int8_t i) {
+    return i < 0 ? -i : i;
+}
+
+static inline uint8_t lerp8by8(uint8_t a, uint8_t b, fract8 frac) {
+    if (b > a) {
+        return a + scale8(b - a, frac);
+    }
+    return a - scale8(a - b, frac);
+}
+
+static inline uint8_t sin8(uint8_t theta) {
+    static const uint8_t b_m16_interleave[] = {0, 49, 49, 41, 90, 27, 117, 10};
+
+    uint8_t offset = theta;
+    if (theta & 0x40) {
+        offset = (uint8_t)255 - offset;
+    }
+    offset &= 0x3F;
+
+    uint8_t secoffset = offset & 0x0F;
+    if (theta & 0x40) {
+        secoffset++;
+    }
+
+    uint8_t section = offset >> 4;
+    uint8_t b       = b_m16_interleave[section * 2];
+    uint8_t m16     = b_m16_interleave[section * 2 + 1];
+    uint8_t mx      = (m16 * secoffset) >> 4;
+
+    int8_t y = mx + b;
+    if (theta & 0x80) {
+        y = -y;
+    }
+    y += 128;
+    return y;
+}
+
+static inline uint8_t cos8(uint8_t theta) {
+    return sin8(theta + 64);
+}
+
+static inline uint8_t sqrt16(uint16_t x) {
+    if (x <= 1) {
+        return x;
+    }
+
+    uint8_t low = 1;
+    uint8_t hi  = x > 7904 ? 255 : (x >> 5) + 8;
+    uint8_t mid;
+    do {
+        mid = (low + hi) >> 1;
+        if ((uint16_t)(mid * mid) > x) {
+            hi = mid - 1;
+        } else {
+            if (mid == 255) {
+                return 255;
+            }
+            low = mid + 1;
+        }
+    } while (hi >= low);
+    return low - 1;
+}
+
+static inline uint8_t atan2_8(int16_t dy, int16_t dx) {
+    if (dy == 0) {
+        return dx >= 0 ? 0 : 128;
+    }
+
+    int16_t abs_y = dy > 0 ? dy : -dy;
+    int8_t  a;
+    if (dx >= 0) {
+        a = 32 - (32 * (dx - abs_y) / (dx + abs_y));
+    } else {
+        a = 96 - (32 * (dx + abs_y) / (abs_y - dx));
+    }
+    return dy < 0 ? -a : a;
+}
+
+static inline uint8_t ease8InOutApprox(fract8 i) {
+    if (i < 64) {
+        i /= 2;
+    } else if (i > (255 - 64)) {
+        i = 255 - i;
+        i /= 2;
+        i = 255 - i;
+    } else {
+        i -= 64;
+        i += i / 2;
+        i += 32;
+    }
+    return i;
+}
+
+// random8.h, seeded with RAND16_SEED like lib8tion.c
+static uint16_t rand16seed = 1337;
+
+static inline void random16_set_seed(uint16_t seed) {
+    rand16seed = seed;
+}
+
+static inline uint8_t random8(void) {
+    rand16seed = (uint16_t)(rand16seed * 2053) + 13849;
+    return (uint8_t)((uint8_t)(rand16seed & 0xFF) + (uint8_t)(rand16seed >> 8));
+}
+
+static inline uint8_t random8_max(uint8_t lim) {
+    return (random8() * lim) >> 8;
+}
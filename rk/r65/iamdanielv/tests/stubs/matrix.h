@@ -0,0 +1,16 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Stand-in for QMK's matrix.h, the tests set MATRIX_ROWS and MATRIX_COLS
+
+#include <stdint.h>
+
+#if MATRIX_COLS <= 8
+typedef uint8_t matrix_row_t;
+#elif MATRIX_COLS <= 16
+typedef uint16_t matrix_row_t;
+#else
+typedef uint32_t matrix_row_t;
+#endif
@@ -0,0 +1,12 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Stand-in for QMK's progmem.h, flash reads are plain loads like on ARM
+
+#include <stdint.h>
+
+#define PROGMEM
+#define pgm_read_byte(address_short) *((uint8_t *)(address_short))
+#define pgm_read_word(address_short) *((uint16_t *)(address_short))
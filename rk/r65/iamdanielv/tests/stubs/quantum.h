@@ -0,0 +1,58 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Stand-in for QMK's quantum.h, only what the units under test use
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "hal.h"
+#include "progmem.h"
+#include "rgb_matrix.h"
+
+// timer.h, each test runs its own clock
+uint16_t timer_read(void);
+uint16_t timer_elapsed(uint16_t last);
+uint32_t timer_read32(void);
+uint32_t timer_elapsed32(uint32_t last);
+#define timer_expired32(current, future) ((uint32_t)(current - future) < UINT32_MAX / 2)
+
+// gpio.h and wait.h
+typedef ioline_t pin_t;
+
+void gpio_set_pin_input_high(pin_t pin);
+void wait_us(uint32_t us);
+
+// the ticks are milliseconds here
+#define wait_ms(ms) chThdSleep(ms)
+
+// keyboard.h and action.h, only the fields the units read
+#define NO_LED 255
+
+typedef struct {
+    uint8_t col;
+    uint8_t row;
+} keypos_t;
+
+typedef enum { TICK_EVENT = 0, KEY_EVENT = 1, ENCODER_CW_EVENT = 2, ENCODER_CCW_EVENT = 3 } keyevent_type_t;
+
+typedef struct {
+    keypos_t key;
+    uint16_t time;
+    uint8_t  type;
+    bool     pressed;
+} keyevent_t;
+
+typedef struct {
+    keyevent_t event;
+} keyrecord_t;
+
+#define IS_KEYEVENT(event) ((event).type == KEY_EVENT)
+#define IS_ENCODEREVENT(event) ((event).type == ENCODER_CW_EVENT || (event).type == ENCODER_CCW_EVENT)
+
+uint8_t layer_switch_get_layer(keypos_t key);
+void    tap_code16(uint16_t code);
@@ -0,0 +1,38 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Stand-in for QMK's report.h, the report layouts without a shared endpoint
+
+#include <stdint.h>
+
+enum hid_report_ids { REPORT_ID_ALL = 0, REPORT_ID_KEYBOARD, REPORT_ID_MOUSE, REPORT_ID_SYSTEM, REPORT_ID_CONSUMER, REPORT_ID_PROGRAMMABLE_BUTTON, REPORT_ID_NKRO };
+
+#define KEYBOARD_REPORT_KEYS 6
+#define NKRO_REPORT_BITS 30
+
+typedef struct {
+    uint8_t mods;
+    uint8_t reserved;
+    uint8_t keys[KEYBOARD_REPORT_KEYS];
+} __attribute__((packed)) report_keyboard_t;
+
+typedef struct {
+    uint8_t report_id;
+    uint8_t mods;
+    uint8_t bits[NKRO_REPORT_BITS];
+} __attribute__((packed)) report_nkro_t;
+
+typedef struct {
+    uint8_t buttons;
+    int8_t  x;
+    int8_t  y;
+    int8_t  v;
+    int8_t  h;
+} __attribute__((packed)) report_mouse_t;
+
+typedef struct {
+    uint8_t  report_id;
+    uint16_t usage;
+} __attribute__((packed)) report_extra_t;
@@ -0,0 +1,75 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Stand-in for QMK's rgb_matrix.h, each test defines the calls its unit makes
+
+#include "color.h"
+
+void    rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
+uint8_t rgb_matrix_get_mode(void);
+void    rgb_matrix_mode_noeeprom(uint8_t mode);
+
+// What the effects see of rgb_matrix.h and rgb_matrix_types.h, only the
+// fields they read. led_config_t needs RGB_MATRIX_LED_COUNT.
+
+#define RGB_MATRIX_HUE_STEP 8
+#define LED_FLAG_ALL 0xFF
+#define HAS_ANY_FLAGS(bits, flags) (((bits) & (flags)) != 0x00)
+
+typedef uint8_t led_flags_t;
+
+typedef struct {
+    uint8_t x;
+    uint8_t y;
+} led_point_t;
+
+typedef struct {
+    uint8_t     iter;
+    led_flags_t flags;
+    bool        init;
+} effect_params_t;
+
+typedef struct {
+    uint8_t     enable;
+    uint8_t     mode;
+    hsv_t       hsv;
+    uint8_t     speed;
+    led_flags_t flags;
+} rgb_config_t;
+
+extern rgb_config_t rgb_matrix_config;
+extern uint32_t     g_rgb_timer;
+extern led_point_t  k_rgb_matrix_center;
+
+uint8_t rgb_matrix_get_hue(void);
+hsv_t   rgb_matrix_get_hsv(void);
+void    rgb_matrix_sethsv_noeeprom(uint16_t hue, uint8_t sat, uint8_t val);
+rgb_t   rgb_matrix_hsv_to_rgb(hsv_t hsv);
+
+#ifdef RGB_MATRIX_LED_COUNT
+typedef struct {
+    led_point_t point[RGB_MATRIX_LED_COUNT];
+    uint8_t     flags[RGB_MATRIX_LED_COUNT];
+} led_config_t;
+
+extern led_config_t g_led_config;
+
+// the whole frame in one pass unless a test splits it like the keyboard does
+#    ifndef RGB_MATRIX_LED_PROCESS_LIMIT
+#        define RGB_MATRIX_LED_PROCESS_LIMIT RGB_MATRIX_LED_COUNT
+#    endif
+
+#    define RGB_MATRIX_USE_LIMITS(min, max)                      \
+        uint8_t min = RGB_MATRIX_LED_PROCESS_LIMIT * params->iter; \
+        uint8_t max = min + RGB_MATRIX_LED_PROCESS_LIMIT;          \
+        if (max > RGB_MATRIX_LED_COUNT) max = RGB_MATRIX_LED_COUNT;
+
+#    define RGB_MATRIX_TEST_LED_FLAGS() \
+        if (!HAS_ANY_FLAGS(g_led_config.flags[i], params->flags)) continue
+
+static inline bool rgb_matrix_check_finished_leds(uint8_t led_idx) {
+    return led_idx < RGB_MATRIX_LED_COUNT;
+}
+#endif
@@ -0,0 +1,34 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Stand-in for QMK's drivers/ws2812.h, with the same timing defaults
+
+#include <stdint.h>
+
+#ifndef WS2812_TIMING
+#    define WS2812_TIMING 1250
+#endif
+#ifndef WS2812_T1H
+#    define WS2812_T1H 900
+#endif
+#ifndef WS2812_T0H
+#    define WS2812_T0H 350
+#endif
+#ifndef WS2812_TRST_US
+#    define WS2812_TRST_US 280
+#endif
+
+#define WS2812_BYTE_ORDER_RGB 0
+#define WS2812_BYTE_ORDER_GRB 1
+#define WS2812_BYTE_ORDER_BGR 2
+
+#ifndef WS2812_BYTE_ORDER
+#    define WS2812_BYTE_ORDER WS2812_BYTE_ORDER_GRB
+#endif
+
+void ws2812_init(void);
+void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
+void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
+void ws2812_flush(void);
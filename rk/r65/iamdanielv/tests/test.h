@@ -0,0 +1,28 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdio.h>
+
+/**
+ * Bare bones checks for the host tests, each test is a program that returns
+ * non-zero when anything failed. Only the first few failures are printed.
+ */
+
+#define TEST_MAX_PRINTED 10
+
+static int test_failures = 0;
+
+#define EXPECT(cond, ...)                                     \
+    do {                                                      \
+        if (!(cond)) {                                        \
+            if (++test_failures <= TEST_MAX_PRINTED) {        \
+                printf("%s:%d: ", __FILE__, __LINE__);        \
+                printf(__VA_ARGS__);                          \
+                printf("\n");                                 \
+            }                                                 \
+        }                                                     \
+    } while (0)
+
+#define TEST_RESULT() (test_failures ? (printf("FAILED: %d checks\n", test_failures), 1) : (printf("ok\n"), 0))
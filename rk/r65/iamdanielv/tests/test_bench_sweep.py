@@ -0,0 +1,75 @@
+# Copyright 2025 DV (@iamdanielv)
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""tools/bench_sweep.py against a keyboard model built from effect_bench.c's reply."""
+
+import os
+import struct
+import sys
+import unittest
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'keymaps', 'iamdanielv', 'tools'))
+
+import bench_sweep  # noqa: E402
+import rawhid  # noqa: E402
+
+EFFECT_MAX = 5  # modes 1 to 4 exist
+DEFAULT_FRAMES = 64
+
+
+def bench_keyboard(report):
+    """effect_bench_hid_command(): refuses mode 0 and modes past the last effect."""
+    mode, speed, frames = report[1:4]
+    if mode == 0 or mode >= EFFECT_MAX:
+        return bytes([report[0], rawhid.STATUS_BAD_ARGS]) + bytes(rawhid.REPORT_SIZE - 2)
+    frames = frames or DEFAULT_FRAMES
+    average = 9600 * mode + speed
+    data = struct.pack('<IIHIB', average, average + 960, average // 66, (mode * 1000 + speed) * 2654435761 & 0xFFFFFFFF, frames)
+    return rawhid.reply_ok(report, data)
+
+
+class TestBenchSweep(unittest.TestCase):
+    def test_request(self):
+        stub = rawhid.StubTransport(bench_keyboard)
+        bench_sweep.bench(stub, 2, 128, 10)
+        self.assertEqual(stub.sent[0][:4], bytes([rawhid.CMD_BENCH_RUN, 2, 128, 10]))
+
+    def test_reply_fields(self):
+        row = bench_sweep.bench(rawhid.StubTransport(bench_keyboard), 1, 0)
+        self.assertEqual(row['frames'], DEFAULT_FRAMES)
+        self.assertEqual(row['cycles_per_frame'], 9600)
+        self.assertEqual(row['us_per_frame'], 100.0)
+        self.assertEqual(row['worst_us'], 110.0)
+        self.assertEqual(row['cycles_per_led'], 9600 // 66)
+        self.assertEqual(row['checksum'], '%08x' % (1000 * 2654435761 & 0xFFFFFFFF))
+
+    def test_sweep_stops_after_the_last_mode(self):
+        stub = rawhid.StubTransport(bench_keyboard)
+        rows = list(bench_sweep.sweep(stub, speeds=[0, 255]))
+        self.assertEqual([(r['mode'], r['speed']) for r in rows], [(m, s) for m in range(1, EFFECT_MAX) for s in (0, 255)])
+        # the refused probe is the last command sent
+        self.assertEqual(stub.sent[-1][1], EFFECT_MAX)
+
+    def test_chosen_modes_must_exist(self):
+        with self.assertRaises(rawhid.HidError):
+            list(bench_sweep.sweep(rawhid.StubTransport(bench_keyboard), speeds=[0], modes=[1, EFFECT_MAX]))
+
+    def test_no_reply(self):
+        with self.assertRaises(rawhid.HidError):
+            bench_sweep.bench(rawhid.StubTransport(lambda report: None), 1, 0)
+
+    def test_compare(self):
+        stub = rawhid.StubTransport(bench_keyboard)
+        baseline = [{k: str(v) for k, v in row.items()} for row in bench_sweep.sweep(stub, speeds=[0, 128])]
+        rows = list(bench_sweep.sweep(stub, speeds=[0, 128, 255]))
+        self.assertEqual(bench_sweep.compare(rows, baseline), [])
+
+        rows[3]['checksum'] = '00000000'
+        self.assertEqual(bench_sweep.compare(rows, baseline), [(rows[3]['mode'], rows[3]['speed'])])
+
+        # a different frame count renders different frames, it isn't compared
+        rows[3]['frames'] = 8
+        self.assertEqual(bench_sweep.compare(rows, baseline), [])
+
+
+if __name__ == '__main__':
+    unittest.main()
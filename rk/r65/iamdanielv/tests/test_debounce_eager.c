@@ -0,0 +1,216 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test.h"
+
+/**
+ * Replays the bounce waveforms in traces/debounce/ through debounce_eager.c,
+ * scanning the way the matrix does, and checks the events it reports.
+ *
+ * A trace is a text file, # starts a comment:
+ *
+ *   keys <row>,<col> ...           the keys the trace drives
+ *   <us> <levels>                  the raw levels from this time on, one 0/1 per key
+ *   press <key> <us> <max us>      a physical press at <us>, reported at most <max us>
+ *                                  after the first scan that reads the key closed
+ *   release <key> <us> <max us>    the same for a release, from the first scan reading it open
+ *   end <us>                       how long to replay
+ *
+ * Every reported event has to match the next annotation of its key, anything
+ * else is a false event. The latency is what the debounce adds to the scan,
+ * a bounce shorter than a scan can be missed by the scan itself. Each trace
+ * is replayed at a few scan phases, so the edges land between scans too, and
+ * the worst latencies are printed.
+ */
+
+#define MATRIX_ROWS 5
+#define MATRIX_COLS 15
+
+// row 1 column 3 chatters, see traces/debounce/chatter.txt
+#define DEBOUNCE_CHATTER_ROWS {0, 1 << 3, 0, 0, 0}
+
+#include "../debounce_eager.c"
+
+// a whole matrix scan at MATRIX_SCAN_HZ, see matrix.c
+#define SCAN_US 250
+
+#define TRACE_DIR "traces/debounce/"
+#define MAX_KEYS 8
+#define MAX_STEPS 64
+#define MAX_EVENTS 16
+
+static uint32_t now_us = 0;
+
+uint16_t timer_read(void) {
+    return now_us / 1000;
+}
+uint16_t timer_elapsed(uint16_t last) {
+    return timer_read() - last;
+}
+
+typedef struct {
+    uint32_t at;
+    char     levels[MAX_KEYS + 1];
+} step_t;
+
+typedef struct {
+    bool     pressed;
+    uint32_t at;
+    uint32_t max_latency; // only for the annotations
+} event_t;
+
+typedef struct {
+    uint8_t  key_count;
+    uint8_t  rows[MAX_KEYS];
+    uint8_t  cols[MAX_KEYS];
+    uint8_t  step_count;
+    step_t   steps[MAX_STEPS];
+    uint8_t  expected_count[MAX_KEYS];
+    event_t  expected[MAX_KEYS][MAX_EVENTS];
+    uint32_t end;
+} trace_t;
+
+static bool load_trace(const char *name, trace_t *trace) {
+    char path[128];
+    snprintf(path, sizeof(path), TRACE_DIR "%s", name);
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        return false;
+    }
+
+    memset(trace, 0, sizeof(*trace));
+    bool ok = true;
+    char line[256];
+    while (ok && fgets(line, sizeof(line), file)) {
+        char    *comment = strchr(line, '#');
+        char     word[16];
+        unsigned key, at, max, n;
+        if (comment) {
+            *comment = '\0';
+        }
+        if (sscanf(line, "%15s", word) != 1) {
+            continue; // blank
+        }
+
+        if (strcmp(word, "keys") == 0) {
+            char    *p = line + strlen("keys");
+            unsigned row, col;
+            while (sscanf(p, " %u,%u%n", &row, &col, (int *)&n) == 2 && trace->key_count < MAX_KEYS) {
+                trace->rows[trace->key_count] = row;
+                trace->cols[trace->key_count] = col;
+                trace->key_count++;
+                p += n;
+            }
+        } else if (strcmp(word, "press") == 0 || strcmp(word, "release") == 0) {
+            ok = sscanf(line, "%*s %u %u %u", &key, &at, &max) == 3 && key < trace->key_count && trace->expected_count[key] < MAX_EVENTS;
+            if (ok) {
+                trace->expected[key][trace->expected_count[key]++] = (event_t){word[0] == 'p', at, max};
+            }
+        } else if (strcmp(word, "end") == 0) {
+            ok = sscanf(line, "%*s %u", &trace->end) == 1;
+        } else {
+            step_t *step = &trace->steps[trace->step_count];
+            ok = trace->step_count < MAX_STEPS && sscanf(line, "%u %8s", &step->at, step->levels) == 2 && strlen(step->levels) == trace->key_count;
+            trace->step_count++;
+        }
+    }
+    fclose(file);
+
+    EXPECT(ok, "%s: can't read \"%s\"", name, strtok(line, "\n"));
+    return ok && trace->key_count > 0 && trace->end > 0;
+}
+
+static void replay(const char *name, uint32_t phase) {
+    trace_t trace;
+    if (!load_trace(name, &trace)) {
+        EXPECT(false, "%s: no trace", name);
+        return;
+    }
+
+    matrix_row_t raw[MATRIX_ROWS]    = {0};
+    matrix_row_t cooked[MATRIX_ROWS] = {0};
+    matrix_row_t last_raw[MATRIX_ROWS];
+    uint8_t      matched[MAX_KEYS]   = {0};
+    uint32_t     seen_at[MAX_KEYS]   = {0}; // first scan that read the next expected level, 0 before
+    uint32_t     press_max = 0, release_max = 0;
+    int          false_events = 0;
+
+    now_us = phase;
+    debounce_init(MATRIX_ROWS);
+
+    uint8_t step = 0;
+    for (; now_us <= trace.end; now_us += SCAN_US) {
+        while (step < trace.step_count && trace.steps[step].at <= now_us) {
+            for (uint8_t k = 0; k < trace.key_count; k++) {
+                matrix_row_t bit = (matrix_row_t)1 << trace.cols[k];
+                raw[trace.rows[k]] = trace.steps[step].levels[k] == '1' ? raw[trace.rows[k]] | bit : raw[trace.rows[k]] & ~bit;
+            }
+            step++;
+        }
+
+        for (uint8_t k = 0; k < trace.key_count; k++) {
+            event_t *expected = &trace.expected[k][matched[k]];
+            bool     closed   = raw[trace.rows[k]] & (1 << trace.cols[k]);
+            if (matched[k] < trace.expected_count[k] && !seen_at[k] && now_us >= expected->at && closed == expected->pressed) {
+                seen_at[k] = now_us;
+            }
+        }
+
+        matrix_row_t last_cooked[MATRIX_ROWS];
+        memcpy(last_cooked, cooked, sizeof(cooked));
+        bool changed = now_us == phase || memcmp(raw, last_raw, sizeof(raw)) != 0;
+        memcpy(last_raw, raw, sizeof(raw));
+        debounce(raw, cooked, MATRIX_ROWS, changed);
+
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            matrix_row_t flipped = cooked[row] ^ last_cooked[row];
+            for (uint8_t col = 0; flipped && col < MATRIX_COLS; col++) {
+                if (!(flipped & (1 << col))) {
+                    continue;
+                }
+                flipped &= ~(1 << col);
+
+                bool    pressed = cooked[row] & (1 << col);
+                uint8_t k       = 0;
+                while (k < trace.key_count && (trace.rows[k] != row || trace.cols[k] != col)) {
+                    k++;
+                }
+                if (k == trace.key_count || matched[k] == trace.expected_count[k]) {
+                    EXPECT(false, "%s: false %s of %u,%u at %u us", name, pressed ? "press" : "release", row, col, now_us);
+                    false_events++;
+                    continue;
+                }
+
+                event_t *expected = &trace.expected[k][matched[k]++];
+                uint32_t latency  = now_us - seen_at[k];
+                EXPECT(pressed == expected->pressed && seen_at[k] != 0, "%s: %s of key %u at %u us, expected the %s at %u us", name, pressed ? "press" : "release", k, now_us, expected->pressed ? "press" : "release", expected->at);
+                EXPECT(latency <= expected->max_latency, "%s: %s of key %u took %u us, at most %u", name, pressed ? "press" : "release", k, latency, expected->max_latency);
+                seen_at[k] = 0;
+                if (pressed && latency > press_max) {
+                    press_max = latency;
+                } else if (!pressed && latency > release_max) {
+                    release_max = latency;
+                }
+            }
+        }
+    }
+
+    for (uint8_t k = 0; k < trace.key_count; k++) {
+        EXPECT(matched[k] == trace.expected_count[k], "%s: key %u reported %u of its %u events", name, k, matched[k], trace.expected_count[k]);
+    }
+
+    printf("%-18s phase %3u us: press <= %3u us, release <= %5u us, %d false events\n", name, phase, press_max, release_max, false_events);
+}
+
+int main(void) {
+    static const char *traces[] = {
+        "clean.txt", "press_bounce.txt", "worn_release.txt", "chatter.txt", "fast_taps.txt", "rollover.txt",
+    };
+
+    for (size_t i = 0; i < sizeof(traces) / sizeof(traces[0]); i++) {
+        for (uint32_t phase = 0; phase < SCAN_US; phase += 90) {
+            replay(traces[i], phase);
+        }
+    }
+    return TEST_RESULT();
+}
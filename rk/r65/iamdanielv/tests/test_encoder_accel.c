@@ -0,0 +1,126 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test.h"
+
+/**
+ * Spins the encoder through features/encoder_accel.c at different speeds
+ * and counts the taps it sends: every detent is sent, acceleration only adds
+ * steps while fewer than ENCODER_ACCEL_MAX_PENDING wait, and the taps are
+ * paced ENCODER_ACCEL_REPORT_MS apart.
+ */
+
+#define NUM_ENCODERS 1
+#define PROGMEM
+#define memcpy_P memcpy
+
+#include "../keymaps/iamdanielv/features/encoder_accel.c"
+
+#define KC_VOLU 0x00A9
+#define KC_VOLD 0x00AA
+
+// the keymap's base layer
+const encoder_accel_t encoder_accel_map[][NUM_ENCODERS] = {{ENCODER_ACCEL(80, 20, 4)}};
+const uint8_t         encoder_accel_map_count = 1;
+
+static uint16_t now_ms = 1000;
+static int      taps_up = 0, taps_down = 0;
+static uint16_t last_tap = 0;
+static uint16_t shortest_gap = 0xFFFF;
+
+uint16_t timer_read(void) {
+    return now_ms;
+}
+uint16_t timer_elapsed(uint16_t last) {
+    return now_ms - last;
+}
+uint8_t layer_switch_get_layer(keypos_t key) {
+    return 0;
+}
+void tap_code16(uint16_t keycode) {
+    if (taps_up + taps_down && now_ms - last_tap < shortest_gap) {
+        shortest_gap = now_ms - last_tap;
+    }
+    last_tap = now_ms;
+    if (keycode == KC_VOLU) {
+        taps_up++;
+    } else if (keycode == KC_VOLD) {
+        taps_down++;
+    }
+}
+
+static void detent(bool clockwise) {
+    keyrecord_t record = {.event = {.key = {.col = 0, .row = 0}, .type = clockwise ? ENCODER_CW_EVENT : ENCODER_CCW_EVENT, .pressed = true}};
+    EXPECT(!process_encoder_accel(clockwise ? KC_VOLU : KC_VOLD, &record), "detent press not taken");
+    record.event.pressed = false;
+    EXPECT(!process_encoder_accel(clockwise ? KC_VOLU : KC_VOLD, &record), "detent release not taken");
+}
+
+static void run(uint16_t ms) {
+    for (uint16_t end = now_ms + ms; now_ms != end; now_ms++) {
+        encoder_accel_task();
+    }
+}
+
+/**
+ * @brief Turns `detents` detents `gap_ms` apart, waits for the steps to go out, returns the taps sent.
+ */
+static int spin(int detents, uint16_t gap_ms) {
+    taps_up = taps_down = 0;
+    run(500); // starts from rest
+    for (int d = 0; d < (detents < 0 ? -detents : detents); d++) {
+        detent(detents > 0);
+        run(gap_ms);
+    }
+    run(ENCODER_ACCEL_MAX_PENDING * ENCODER_ACCEL_REPORT_MS + 50);
+    return detents > 0 ? taps_up : -taps_down;
+}
+
+static void test_slow_turns(void) {
+    EXPECT(spin(5, 200) == 5, "5 slow detents sent %d steps", spin(5, 200));
+    EXPECT(spin(-5, 200) == -5, "5 slow detents back sent %d steps", spin(-5, 200));
+}
+
+static void test_faster_is_never_fewer(void) {
+    // the same 12 detents, from a slow turn to a spin faster than the steps go out
+    int slowest = spin(12, 200);
+    for (uint16_t gap = 120; gap >= 4; gap -= 4) {
+        int steps = spin(12, gap);
+        EXPECT(steps >= slowest, "12 detents %u ms apart sent %d steps, %d on a slow turn", gap, steps, slowest);
+    }
+    EXPECT(spin(12, 30) > 12, "a quick spin never accelerated");
+}
+
+static void test_backlog(void) {
+    // detents far faster than the steps go out: each still counts, the acceleration stops
+    taps_up      = 0;
+    shortest_gap = 0xFFFF;
+    run(500);
+    for (int d = 0; d < 40; d++) {
+        detent(true);
+        run(2);
+        EXPECT(accel_state[0].pending <= ENCODER_ACCEL_MAX_PENDING + d, "%d steps wait after %d detents", accel_state[0].pending, d + 1);
+    }
+    run(2000);
+    EXPECT(taps_up >= 40, "40 fast detents sent %d steps", taps_up);
+    EXPECT(taps_up <= 40 + ENCODER_ACCEL_MAX_PENDING, "40 fast detents sent %d steps, the backlog kept accelerating", taps_up);
+    EXPECT(shortest_gap >= ENCODER_ACCEL_REPORT_MS, "two steps %u ms apart", shortest_gap);
+}
+
+static void test_turning_back_cancels(void) {
+    taps_up = taps_down = 0;
+    run(500);
+    detent(true);
+    detent(true);
+    detent(false);
+    run(500);
+    EXPECT(taps_up == 1 && taps_down == 0, "two up and one down sent %d up and %d down", taps_up, taps_down);
+}
+
+int main(void) {
+    test_slow_turns();
+    test_faster_is_never_fewer();
+    test_backlog();
+    test_turning_back_cancels();
+    return TEST_RESULT();
+}
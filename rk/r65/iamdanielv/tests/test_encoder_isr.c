@@ -0,0 +1,246 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test.h"
+
+/**
+ * Replays A/B edge sequences through encoder_isr.c: the pins are set, the
+ * edge callback the driver registered is called for each pin that moved,
+ * and encoder_driver_task() turns the pulses into events.
+ *
+ * The table gives -1 for A leading B, so four edges with A leading are one
+ * ENCODER_CLOCKWISE event. Which way that is on the knob depends on the
+ * wiring, the tests only name the two sequences.
+ */
+
+#define NUM_ENCODERS 1
+#define ENCODER_A_PINS {1}
+#define ENCODER_B_PINS {2}
+#define MAX_LINES 3
+
+#include "../encoder_isr.c"
+
+static uint8_t       pin_level[MAX_LINES];
+static palcallback_t pin_callback[MAX_LINES];
+static void         *pin_arg[MAX_LINES];
+static int           lock_depth = 0;
+
+static int clockwise_events = 0, counter_clockwise_events = 0;
+
+uint8_t palReadLine(ioline_t line) {
+    return pin_level[line];
+}
+void palEnableLineEvent(ioline_t line, uint32_t mode) {
+    EXPECT(mode == PAL_EVENT_MODE_BOTH_EDGES, "line %u doesn't fire on both edges", line);
+}
+void palSetLineCallback(ioline_t line, palcallback_t cb, void *arg) {
+    pin_callback[line] = cb;
+    pin_arg[line]      = arg;
+}
+void osalSysLock(void) {
+    lock_depth++;
+}
+void osalSysUnlock(void) {
+    lock_depth--;
+}
+void osalSysLockFromISR(void) {
+    lock_depth++;
+}
+void osalSysUnlockFromISR(void) {
+    lock_depth--;
+}
+void gpio_set_pin_input_high(pin_t pin) {
+    pin_level[pin] = 1;
+}
+void wait_us(uint32_t us) {}
+
+void encoder_queue_event(uint8_t index, bool clockwise) {
+    EXPECT(index == 0, "event for encoder %u", index);
+    EXPECT(lock_depth == 0, "event queued inside a lock");
+    if (clockwise) {
+        clockwise_events++;
+    } else {
+        counter_clockwise_events++;
+    }
+}
+
+// B << 1 | A for each quarter step, A leading is clockwise
+static const uint8_t clockwise_steps[4] = {0x1, 0x3, 0x2, 0x0};
+
+static uint8_t state(void) {
+    return pin_level[2] << 1 | pin_level[1];
+}
+
+/**
+ * @brief Moves the pins to `to`, then runs the callback of each pin that moved, like the EXTI would.
+ */
+static void move(uint8_t to) {
+    uint8_t moved = state() ^ to;
+    pin_level[1]  = to & 1;
+    pin_level[2]  = to >> 1;
+    for (uint8_t line = 1; line <= 2; line++) {
+        if (moved & (1 << (line - 1))) {
+            pin_callback[line](pin_arg[line]);
+        }
+    }
+}
+
+/**
+ * @brief Like move(), but both callbacks run with the pins already at `to`, the first edge was serviced late.
+ */
+static void move_late(uint8_t to) {
+    pin_level[1] = to & 1;
+    pin_level[2] = to >> 1;
+    pin_callback[1](pin_arg[1]);
+    pin_callback[2](pin_arg[2]);
+}
+
+static void turn(int detents) {
+    for (int d = 0; d < (detents < 0 ? -detents : detents); d++) {
+        for (uint8_t q = 0; q < 4; q++) {
+            // counter clockwise walks the same states backwards, from 00 back to 00
+            move(detents > 0 ? clockwise_steps[q] : clockwise_steps[(6 - q) % 4]);
+        }
+    }
+}
+
+static void reset(void) {
+    memset(pin_level, 0, sizeof(pin_level));
+    encoder_driver_init();
+    EXPECT(state() == 0x3, "pins not pulled up");
+    // park in the detent at 00, the rest position the table counts from
+    move(0x2);
+    move(0x0);
+    encoder_driver_task();
+    encoder_pulses[0]        = 0;
+    clockwise_events         = 0;
+    counter_clockwise_events = 0;
+}
+
+static void drain(void) {
+    for (int pass = 0; pass < 100; pass++) {
+        encoder_driver_task();
+    }
+}
+
+static void test_clean_turns(void) {
+    reset();
+    EXPECT(pin_callback[1] && pin_callback[2], "no callback on the A and B pins");
+
+    turn(3);
+    encoder_driver_task();
+    EXPECT(clockwise_events == 3 && counter_clockwise_events == 0, "3 clockwise detents gave %d / %d", clockwise_events, counter_clockwise_events);
+
+    turn(-2);
+    encoder_driver_task();
+    EXPECT(clockwise_events == 3 && counter_clockwise_events == 2, "2 counter clockwise detents gave %d / %d", clockwise_events, counter_clockwise_events);
+    EXPECT(lock_depth == 0, "locks left taken");
+}
+
+static void test_half_turn_back(void) {
+    reset();
+
+    // two quarter steps forward and back again is no detent
+    move(clockwise_steps[0]);
+    move(clockwise_steps[1]);
+    encoder_driver_task();
+    move(clockwise_steps[0]);
+    move(0x0);
+    drain();
+    EXPECT(clockwise_events == 0 && counter_clockwise_events == 0, "a half turn back gave %d / %d", clockwise_events, counter_clockwise_events);
+}
+
+static void test_bounce(void) {
+    reset();
+
+    // A chatters on every edge, each bounce is a step forward and one back
+    for (uint8_t q = 0; q < 4; q++) {
+        uint8_t before = state();
+        move(clockwise_steps[q]);
+        move(before);
+        move(clockwise_steps[q]);
+    }
+    drain();
+    EXPECT(clockwise_events == 1 && counter_clockwise_events == 0, "a bouncing detent gave %d / %d", clockwise_events, counter_clockwise_events);
+}
+
+static void test_illegal_transitions(void) {
+    reset();
+
+    // 00 <-> 11 skips a state, the direction is unknown so it counts nothing
+    for (int i = 0; i < 10; i++) {
+        move(0x3);
+        move(0x0);
+    }
+    drain();
+    EXPECT(encoder_pulses[0] == 0, "illegal transitions counted %d pulses", encoder_pulses[0]);
+    EXPECT(clockwise_events == 0 && counter_clockwise_events == 0, "illegal transitions gave %d / %d", clockwise_events, counter_clockwise_events);
+
+    // the decoding goes on from wherever the pins ended up
+    turn(2);
+    drain();
+    EXPECT(clockwise_events == 2, "%d clockwise detents after the illegal transitions, expected 2", clockwise_events);
+}
+
+static void test_missed_edges(void) {
+    reset();
+
+    // the first edge of the second quarter step is serviced after the second one,
+    // that step reads as 01 -> 10, which counts nothing
+    for (int detent = 0; detent < 8; detent++) {
+        move(clockwise_steps[0]);
+        move_late(clockwise_steps[2]);
+        move(clockwise_steps[3]);
+    }
+    drain();
+
+    // half of each detent is lost, but never counted the wrong way
+    EXPECT(counter_clockwise_events == 0, "missed edges turned into %d counter clockwise events", counter_clockwise_events);
+    EXPECT(clockwise_events == 4, "8 detents with a missed step gave %d clockwise events, expected 4", clockwise_events);
+
+    // a lone missed edge only costs the detent it happens in
+    reset();
+    turn(5);
+    move(clockwise_steps[0]);
+    move_late(clockwise_steps[2]);
+    move(clockwise_steps[3]);
+    turn(5);
+    drain();
+    EXPECT(clockwise_events == 10 && counter_clockwise_events == 0, "10 clean detents and one with a missed step gave %d / %d", clockwise_events, counter_clockwise_events);
+}
+
+static void test_busy_main_loop(void) {
+    reset();
+
+    // a long spin while the main loop is stuck, then passes of at most MAX_QUEUED_ENCODER_EVENTS
+    turn(23);
+    int passes = 0;
+    while (clockwise_events < 23 && passes < 100) {
+        int before = clockwise_events;
+        encoder_driver_task();
+        EXPECT(clockwise_events - before <= MAX_QUEUED_ENCODER_EVENTS, "%d events in one pass", clockwise_events - before);
+        passes++;
+    }
+    EXPECT(clockwise_events == 23 && counter_clockwise_events == 0, "23 detents in one go gave %d / %d", clockwise_events, counter_clockwise_events);
+    EXPECT(passes == (23 + MAX_QUEUED_ENCODER_EVENTS - 1) / MAX_QUEUED_ENCODER_EVENTS, "took %d passes", passes);
+
+    // edges that arrive between passes join the pulses carried over
+    reset();
+    turn(-12);
+    encoder_driver_task();
+    turn(-3);
+    move(clockwise_steps[2]);
+    drain();
+    EXPECT(counter_clockwise_events == 15, "15 counter clockwise detents over two spins gave %d", counter_clockwise_events);
+    EXPECT(encoder_pulses[0] == 1, "the quarter step left over is %d pulses", encoder_pulses[0]);
+}
+
+int main(void) {
+    test_clean_turns();
+    test_half_turn_back();
+    test_bounce();
+    test_illegal_transitions();
+    test_missed_edges();
+    test_busy_main_loop();
+    return TEST_RESULT();
+}
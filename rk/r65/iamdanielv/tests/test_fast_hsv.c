@@ -0,0 +1,33 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test.h"
+#include "fast_hsv.h"
+
+/**
+ * fast_hsv_to_rgb() against QMK's hsv_to_rgb() for every one of the 2^24 HSV
+ * inputs, linked against quantum/color.c from QMK_HOME. Built once as is and
+ * once with USE_CIE1931_CURVE, see the Makefile.
+ */
+
+void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    (void)index;
+    (void)red;
+    (void)green;
+    (void)blue;
+}
+
+int main(void) {
+    uint32_t checked = 0;
+    for (uint32_t i = 0; i < (1UL << 24); i++) {
+        hsv_t hsv = {.h = i >> 16, .s = (i >> 8) & 0xFF, .v = i & 0xFF};
+
+        rgb_t expected = hsv_to_rgb(hsv);
+        rgb_t actual   = fast_hsv_to_rgb(hsv);
+        EXPECT(expected.r == actual.r && expected.g == actual.g && expected.b == actual.b, "hsv %3u %3u %3u: expected %3u %3u %3u, got %3u %3u %3u", hsv.h, hsv.s, hsv.v, expected.r, expected.g, expected.b, actual.r, actual.g, actual.b);
+        checked++;
+    }
+
+    printf("fast_hsv: %lu inputs compared\n", (unsigned long)checked);
+    return TEST_RESULT();
+}
@@ -0,0 +1,118 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test.h"
+
+/**
+ * Presses keys into features/heatmap.c and reads the heat back over long
+ * stretches of time, including breaks where nothing is drawn and keys the
+ * effect never draws, so the 8 bit touch tick gets to wrap.
+ */
+
+#define RGB_MATRIX_LED_COUNT 66
+#define PALETTEFX_HEATMAP_ENABLE
+#define RGB_MATRIX_CUSTOM_PALETTEFX_HEATMAP 7
+
+#include "../keymaps/iamdanielv/features/heatmap.c"
+
+const uint8_t led_matrix_to_led[LED_TABLES_ROWS][LED_TABLES_COLS] = LED_TABLES_MATRIX_TO_LED;
+
+static uint32_t now_ms = 5000;
+static uint8_t  mode   = RGB_MATRIX_CUSTOM_PALETTEFX_HEATMAP;
+
+uint32_t timer_read32(void) {
+    return now_ms;
+}
+uint8_t rgb_matrix_get_mode(void) {
+    return mode;
+}
+
+static void press(uint8_t row, uint8_t col) {
+    keyrecord_t record = {.event = {.key = {.col = col, .row = row}, .type = KEY_EVENT, .pressed = true}};
+    heatmap_record(&record);
+}
+
+static uint8_t heat(uint8_t led) {
+    return heatmap_read(led, heatmap_now());
+}
+
+/**
+ * @brief Lets `ms` pass, drawing a frame every 16 ms that skips the LEDs in `skip` when `drawing`.
+ */
+static void run(uint32_t ms, bool drawing, uint8_t skip) {
+    for (uint32_t end = now_ms + ms; now_ms < end; now_ms += 16) {
+        if (drawing) {
+            uint8_t now = heatmap_now();
+            for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+                if (i != skip) {
+                    heatmap_read(i, now);
+                }
+            }
+        }
+    }
+}
+
+static void test_decay(void) {
+    uint8_t led = led_matrix_to_led[2][5];
+    heatmap_clear();
+    press(2, 5);
+    EXPECT(heat(led) == HEATMAP_PRESS_HEAT, "one press is %u", heat(led));
+    for (int i = 0; i < 10; i++) {
+        press(2, 5);
+    }
+    EXPECT(heat(led) == HEAT_MAX, "heat tops out at %u", heat(led));
+
+    run(HEATMAP_DECAY_MS, true, NO_LED);
+    EXPECT(heat(led) == HEAT_MAX - 1, "one decay step later the heat is %u", heat(led));
+    run(HEAT_MAX * HEATMAP_DECAY_MS, true, NO_LED);
+    EXPECT(heat(led) == 0, "fully decayed key is %u", heat(led));
+}
+
+static void test_break_in_drawing(void) {
+    uint8_t led = led_matrix_to_led[1][1];
+    heatmap_clear();
+    for (int i = 0; i < 4; i++) {
+        press(1, 1);
+    }
+
+    // RGB off or suspended for exactly one wrap of the 8 bit tick, then drawn again
+    run(256 * HEATMAP_DECAY_MS, false, NO_LED);
+    EXPECT(heat(led) == 0, "a key is %u after a wrap with nothing drawn", heat(led));
+
+    // and for breaks of every length around it
+    for (uint32_t ticks = 15; ticks < 600; ticks += 7) {
+        heatmap_clear();
+        press(1, 1);
+        run(ticks * HEATMAP_DECAY_MS, false, NO_LED);
+        EXPECT(heat(led) == 0, "a key is %u after %u ticks with nothing drawn", heat(led), ticks);
+    }
+}
+
+static void test_undrawn_key(void) {
+    uint8_t led = led_matrix_to_led[0][0];
+
+    // the key is skipped by the LED flags while the effect keeps drawing the rest,
+    // nothing reads it until the tick has wrapped, maybe more than once
+    static const uint16_t breaks[] = {16, 100, 255, 256, 259, 300, 512, 515, 770, 1030};
+    for (uint8_t b = 0; b < sizeof(breaks) / sizeof(breaks[0]); b++) {
+        uint16_t ticks = breaks[b];
+        heatmap_clear();
+        press(0, 0);
+        press(0, 0);
+        run(ticks * HEATMAP_DECAY_MS, true, led);
+        EXPECT(heat(led) == 0, "an undrawn key is %u after %u ticks", heat(led), ticks);
+    }
+
+    // presses while another effect runs leave nothing behind
+    mode = 1;
+    press(0, 0);
+    EXPECT(heat(led) == 0, "a press under another effect added heat");
+    mode = RGB_MATRIX_CUSTOM_PALETTEFX_HEATMAP;
+}
+
+int main(void) {
+    test_decay();
+    test_break_in_drawing();
+    test_undrawn_key();
+    return TEST_RESULT();
+}
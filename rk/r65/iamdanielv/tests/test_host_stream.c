@@ -0,0 +1,129 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test.h"
+
+/**
+ * Feeds HID_CMD_STREAM_FRAME packets to features/host_stream.c and checks the
+ * frame the HOST_STREAM effect would draw: whole frames, frames that only
+ * resend the LEDs that changed, bad chunks, and the switch back to the
+ * previous effect after the timeout.
+ */
+
+#define RGB_MATRIX_LED_COUNT 66
+#define RGB_MATRIX_CUSTOM_HOST_STREAM 42
+#define TEST_PREVIOUS_MODE 7
+
+#include "../keymaps/iamdanielv/features/host_stream.c"
+
+static uint32_t now_ms = 1000;
+static uint8_t  mode   = TEST_PREVIOUS_MODE;
+static uint8_t  kicks  = 0;
+
+uint32_t timer_read32(void) {
+    return now_ms;
+}
+uint32_t timer_elapsed32(uint32_t last) {
+    return now_ms - last;
+}
+uint8_t rgb_matrix_get_mode(void) {
+    return mode;
+}
+void rgb_matrix_mode_noeeprom(uint8_t new_mode) {
+    mode = new_mode;
+}
+void rgb_governor_kick(void) {
+    kicks++;
+}
+
+#define LEDS_PER_CHUNK 9
+
+static rgb_t expected[RGB_MATRIX_LED_COUNT];
+
+/**
+ * @brief Sends LEDs first .. first + count - 1 of `frame` as one chunk, returns the status.
+ */
+static uint8_t send_chunk(const rgb_t *frame, uint8_t first, uint8_t count, bool end) {
+    uint8_t packet[32] = {HID_CMD_STREAM_FRAME, first, count, end ? HOST_STREAM_FLAG_END : 0};
+    memcpy(&packet[4], &frame[first], 3 * count);
+    return host_stream_hid_command(packet, sizeof(packet));
+}
+
+/**
+ * @brief Sends LEDs `first` to `last` (exclusive) in chunks, the last chunk shows the frame.
+ */
+static void send_range(const rgb_t *frame, uint8_t first, uint8_t last) {
+    for (uint8_t led = first; led < last; led += LEDS_PER_CHUNK) {
+        uint8_t count = last - led < LEDS_PER_CHUNK ? last - led : LEDS_PER_CHUNK;
+        EXPECT(send_chunk(frame, led, count, led + count == last) == HID_STATUS_OK, "chunk at %u refused", led);
+    }
+}
+
+static bool shows_expected(void) {
+    return memcmp(host_stream_frame(), expected, sizeof(expected)) == 0;
+}
+
+static void test_whole_frames(void) {
+    for (uint8_t round = 0; round < 3; round++) {
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            expected[i] = (rgb_t){i, round, 255 - i};
+        }
+        send_range(expected, 0, RGB_MATRIX_LED_COUNT);
+        EXPECT(shows_expected(), "whole frame %u is not shown", round);
+    }
+    EXPECT(mode == RGB_MATRIX_CUSTOM_HOST_STREAM, "the first frame didn't switch to the stream effect");
+}
+
+static void test_partial_frames(void) {
+    // after any number of swaps, a frame that only resends a few LEDs keeps all the others
+    for (uint8_t round = 0; round < 5; round++) {
+        uint8_t first = round * 13;
+        for (uint8_t i = first; i < first + 4; i++) {
+            expected[i] = (rgb_t){200, round, i};
+        }
+        send_range(expected, first, first + 4);
+        EXPECT(shows_expected(), "partial frame %u (LEDs %u - %u) left stale LEDs", round, first, first + 3);
+    }
+}
+
+static void test_no_show_without_end(void) {
+    rgb_t next[RGB_MATRIX_LED_COUNT];
+    memcpy(next, expected, sizeof(next));
+    next[0] = (rgb_t){1, 2, 3};
+    send_chunk(next, 0, 1, false);
+    EXPECT(shows_expected(), "a chunk without the end flag changed the shown frame");
+
+    // the end flag shows everything sent since the last frame
+    expected[0] = next[0];
+    expected[1] = (rgb_t){4, 5, 6};
+    send_chunk(expected, 1, 1, true);
+    EXPECT(shows_expected(), "the end flag didn't show the chunks before it");
+}
+
+static void test_bad_chunks(void) {
+    rgb_t junk[RGB_MATRIX_LED_COUNT + LEDS_PER_CHUNK] = {0};
+    EXPECT(send_chunk(junk, RGB_MATRIX_LED_COUNT, 1, true) == HID_STATUS_BAD_ARGS, "first LED past the end accepted");
+    EXPECT(send_chunk(junk, RGB_MATRIX_LED_COUNT - 2, 3, true) == HID_STATUS_BAD_ARGS, "chunk running past the last LED accepted");
+    EXPECT(send_chunk(junk, 0, LEDS_PER_CHUNK + 1, true) == HID_STATUS_BAD_ARGS, "chunk longer than the packet accepted");
+    EXPECT(shows_expected(), "a refused chunk changed the shown frame");
+}
+
+static void test_timeout(void) {
+    now_ms += HOST_STREAM_TIMEOUT_MS - 1;
+    host_stream_task();
+    EXPECT(mode == RGB_MATRIX_CUSTOM_HOST_STREAM, "stream stopped before the timeout");
+
+    now_ms += 1;
+    host_stream_task();
+    EXPECT(mode == TEST_PREVIOUS_MODE, "previous effect not restored after the timeout, mode %u", mode);
+}
+
+int main(void) {
+    test_whole_frames();
+    test_partial_frames();
+    test_no_show_without_end();
+    test_bad_chunks();
+    test_timeout();
+    EXPECT(kicks > 0, "the governor was never kicked");
+    return TEST_RESULT();
+}
@@ -0,0 +1,117 @@
+# Copyright 2025 DV (@iamdanielv)
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""tools/host_stream.py and tools/rawhid.py against a stub keyboard."""
+
+import os
+import sys
+import unittest
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'keymaps', 'iamdanielv', 'tools'))
+
+import host_stream  # noqa: E402
+import rawhid  # noqa: E402
+
+LED_COUNT = 66
+
+
+class StreamingKeyboard:
+    """The double buffer of features/host_stream.c, as a StubTransport handler."""
+
+    def __init__(self):
+        self.frames = [[(0, 0, 0)] * LED_COUNT, [(0, 0, 0)] * LED_COUNT]
+        self.front = 0
+        self.shown = 0
+
+    def __call__(self, report):
+        first, count, flags = report[1], report[2], report[3]
+        if report[0] != rawhid.CMD_STREAM_FRAME or first >= LED_COUNT or count > LED_COUNT - first or 4 + 3 * count > rawhid.REPORT_SIZE:
+            return bytes([report[0], rawhid.STATUS_BAD_ARGS]) + bytes(rawhid.REPORT_SIZE - 2)
+
+        back = self.frames[self.front ^ 1]
+        for i in range(count):
+            back[first + i] = tuple(report[4 + 3 * i:7 + 3 * i])
+        if flags & host_stream.FLAG_END:
+            self.front ^= 1
+            self.frames[self.front ^ 1] = list(self.frames[self.front])
+            self.shown += 1
+        return rawhid.reply_ok(report)
+
+    def frame(self):
+        return self.frames[self.front]
+
+
+class TestRawHid(unittest.TestCase):
+    def test_report_is_padded(self):
+        report = rawhid.build_report(0x44, b'\x01\x02')
+        self.assertEqual(len(report), rawhid.REPORT_SIZE)
+        self.assertEqual(report[:3], b'\x44\x01\x02')
+        self.assertEqual(report[3:], bytes(rawhid.REPORT_SIZE - 3))
+
+    def test_too_many_args(self):
+        with self.assertRaises(ValueError):
+            rawhid.build_report(0x44, bytes(rawhid.MAX_ARGS + 1))
+
+    def test_error_status_raises(self):
+        stub = rawhid.StubTransport(lambda report: bytes([report[0], rawhid.STATUS_BAD_ARGS]) + bytes(30))
+        with self.assertRaises(rawhid.HidError) as caught:
+            rawhid.command(stub, 0x45, b'\x00')
+        self.assertEqual(caught.exception.status, rawhid.STATUS_BAD_ARGS)
+
+    def test_no_reply_raises(self):
+        stub = rawhid.StubTransport(lambda report: None)
+        with self.assertRaises(rawhid.HidError):
+            rawhid.command(stub, 0x44)
+
+    def test_reply_data(self):
+        stub = rawhid.StubTransport(lambda report: rawhid.reply_ok(report, b'\xAA\xBB'))
+        self.assertEqual(rawhid.command(stub, 0x43)[:2], b'\xAA\xBB')
+
+
+class TestHostStream(unittest.TestCase):
+    def setUp(self):
+        self.keyboard = StreamingKeyboard()
+        self.stub = rawhid.StubTransport(self.keyboard)
+
+    def test_whole_frame_chunks(self):
+        frame = host_stream.rainbow(0.0, LED_COUNT)
+        chunks = host_stream.frame_chunks(frame)
+        self.assertEqual(len(chunks), (LED_COUNT + host_stream.LEDS_PER_CHUNK - 1) // host_stream.LEDS_PER_CHUNK)
+        self.assertEqual([c[2] & host_stream.FLAG_END for c in chunks], [0] * (len(chunks) - 1) + [host_stream.FLAG_END])
+        self.assertTrue(all(len(rawhid.build_report(rawhid.CMD_STREAM_FRAME, c)) == rawhid.REPORT_SIZE for c in chunks))
+
+    def test_changed_runs(self):
+        previous = [(0, 0, 0)] * 10
+        frame = list(previous)
+        frame[2] = frame[3] = frame[9] = (1, 1, 1)
+        self.assertEqual(host_stream.changed_runs(frame, previous), [(2, 4), (9, 10)])
+        self.assertEqual(host_stream.changed_runs(frame), [(0, 10)])
+
+    def test_stream_shows_every_frame(self):
+        previous = None
+        for step in range(20):
+            frame = host_stream.chase(step / 20, LED_COUNT) if step % 2 else host_stream.rainbow(step / 20, LED_COUNT)
+            host_stream.send_frame(self.stub, frame, previous)
+            self.assertEqual(self.keyboard.frame(), frame, 'frame %d' % step)
+            previous = frame
+        self.assertEqual(self.keyboard.shown, 20)
+
+    def test_partial_frames_send_less(self):
+        frame = host_stream.chase(0.0, LED_COUNT)
+        host_stream.send_frame(self.stub, frame)
+        whole = len(self.stub.sent)
+
+        following = host_stream.chase(0.05, LED_COUNT)
+        sent = host_stream.send_frame(self.stub, following, frame)
+        self.assertLess(sent, whole)
+        self.assertEqual(self.keyboard.frame(), following)
+
+    def test_unchanged_frame_still_shows(self):
+        frame = host_stream.solid(0.0, LED_COUNT)
+        host_stream.send_frame(self.stub, frame)
+        self.assertEqual(host_stream.send_frame(self.stub, frame, frame), 1)
+        self.assertEqual(self.keyboard.shown, 2)
+        self.assertEqual(self.keyboard.frame(), frame)
+
+
+if __name__ == '__main__':
+    unittest.main()
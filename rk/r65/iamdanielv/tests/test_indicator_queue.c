@@ -0,0 +1,116 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test.h"
+
+/**
+ * Sends HID_CMD_INDICATORS batches to features/indicator_queue.c: entries
+ * that are queued and flash the right number of times, dequeues, and the
+ * out of range entries that must refuse the whole batch.
+ */
+
+#define RGB_MATRIX_LED_COUNT 66
+
+#include "../keymaps/iamdanielv/features/indicator_queue.c"
+
+static uint32_t now_ms = 1000;
+
+uint32_t timer_read32(void) {
+    return now_ms;
+}
+uint32_t timer_elapsed32(uint32_t last) {
+    return now_ms - last;
+}
+void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {}
+rgb_t get_complementary_rgb(rgb_t rgb_led, bool darken) {
+    return (rgb_t){255 - rgb_led.r, 255 - rgb_led.g, 255 - rgb_led.b};
+}
+
+typedef struct {
+    uint8_t led, interval, flashes, r, g, b;
+} entry_t;
+
+static uint8_t send_batch(const entry_t *entries, uint8_t count) {
+    uint8_t packet[32] = {HID_CMD_INDICATORS, count};
+    memcpy(&packet[2], entries, count * sizeof(entry_t));
+    return indicator_queue_hid_command(packet, sizeof(packet));
+}
+
+static uint8_t active_count(void) {
+    uint8_t active = 0;
+    for (int i = 0; i < INDICATOR_QUEUE_MAX; i++) {
+        active += indicator_queue[i].active;
+    }
+    return active;
+}
+
+/**
+ * @brief Runs the queue until it empties, returns how many interval steps that took.
+ */
+static uint32_t steps_until_done(uint32_t interval_ms) {
+    uint32_t steps = 0;
+    while (active_count() && steps < 1000) {
+        now_ms += interval_ms;
+        process_indicator_queue(0, RGB_MATRIX_LED_COUNT);
+        steps++;
+    }
+    return steps;
+}
+
+static void test_flashes(void) {
+    for (uint8_t flashes = 1; flashes <= INDICATOR_HID_MAX_FLASHES; flashes += 7) {
+        entry_t entry = {3, 20, flashes, 255, 0, 0};
+        EXPECT(send_batch(&entry, 1) == HID_STATUS_OK, "%u flashes refused", flashes);
+        EXPECT(active_count() == 1, "%u flashes not queued", flashes);
+
+        // every flash is an on and an off step
+        uint32_t steps = steps_until_done(entry.interval * INDICATOR_HID_INTERVAL_UNIT);
+        EXPECT(steps == 2u * flashes, "%u flashes took %u steps", flashes, steps);
+    }
+
+    entry_t most = {3, 1, INDICATOR_HID_MAX_FLASHES, 0, 0, 255};
+    EXPECT(send_batch(&most, 1) == HID_STATUS_OK, "INDICATOR_HID_MAX_FLASHES refused");
+    EXPECT(steps_until_done(INDICATOR_HID_INTERVAL_UNIT) == 2u * INDICATOR_HID_MAX_FLASHES, "INDICATOR_HID_MAX_FLASHES cut short");
+}
+
+static void test_dequeue(void) {
+    entry_t entries[2] = {{5, 10, 4, 0, 255, 0}, {6, 10, 4, 0, 255, 0}};
+    EXPECT(send_batch(entries, 2) == HID_STATUS_OK, "batch of 2 refused");
+    EXPECT(active_count() == 2, "batch of 2 not queued");
+
+    // 0 flashes dequeues, the interval doesn't matter then
+    entry_t dequeue = {5, 0, 0, 0, 0, 0};
+    EXPECT(send_batch(&dequeue, 1) == HID_STATUS_OK, "dequeue refused");
+    EXPECT(active_count() == 1, "dequeue left %u entries", active_count());
+
+    steps_until_done(100);
+}
+
+static void test_refused(void) {
+    const entry_t bad[] = {
+        {RGB_MATRIX_LED_COUNT, 10, 1, 0, 0, 0},         // no such LED
+        {7, 0, 1, 0, 0, 0},                             // would expire on every tick
+        {7, 10, INDICATOR_HID_MAX_FLASHES + 1, 0, 0, 0}, // doubled count overflows
+        {7, 10, 255, 0, 0, 0},
+    };
+
+    for (uint8_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+        // a good entry first, the bad one must take the whole batch down
+        entry_t batch[2] = {{8, 10, 1, 0, 0, 0}, bad[i]};
+        EXPECT(send_batch(batch, 2) == HID_STATUS_BAD_ARGS, "bad entry %u accepted", i);
+        EXPECT(active_count() == 0, "bad entry %u left part of its batch queued", i);
+    }
+
+    entry_t none = {0};
+    EXPECT(send_batch(&none, 0) == HID_STATUS_BAD_ARGS, "empty batch accepted");
+
+    uint8_t too_long[32] = {HID_CMD_INDICATORS, 6};
+    EXPECT(indicator_queue_hid_command(too_long, sizeof(too_long)) == HID_STATUS_BAD_ARGS, "batch longer than the packet accepted");
+}
+
+int main(void) {
+    test_flashes();
+    test_dequeue();
+    test_refused();
+    return TEST_RESULT();
+}
@@ -0,0 +1,73 @@
+# Copyright 2025 DV (@iamdanielv)
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""tools/indicators.py, the host encoder for HID_CMD_INDICATORS."""
+
+import os
+import sys
+import unittest
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'keymaps', 'iamdanielv', 'tools'))
+
+import indicators  # noqa: E402
+import rawhid  # noqa: E402
+
+
+def keyboard_accepts(report):
+    """The checks of indicator_queue_hid_command(), as a StubTransport handler."""
+    count = report[1]
+    ok = count > 0 and 2 + count * indicators.ENTRY_SIZE <= rawhid.REPORT_SIZE
+    for i in range(count if ok else 0):
+        led, interval, flashes = report[2 + i * 6:5 + i * 6]
+        if led >= indicators.LED_COUNT or (flashes and (interval == 0 or flashes > indicators.MAX_FLASHES)):
+            ok = False
+    status = rawhid.STATUS_OK if ok else rawhid.STATUS_BAD_ARGS
+    return bytes([report[0], status]) + bytes(rawhid.REPORT_SIZE - 2)
+
+
+class TestIndicators(unittest.TestCase):
+    def test_entry_bytes(self):
+        entry = indicators.encode_entry(indicators.flash(12, 150, 3, (1, 2, 3)))
+        self.assertEqual(entry, bytes([12, 15, 3, 1, 2, 3]))
+
+    def test_interval_rounds_up(self):
+        self.assertEqual(indicators.encode_entry(indicators.flash(0, 1, 1))[1], 1)
+        self.assertEqual(indicators.encode_entry(indicators.flash(0, 11, 1))[1], 2)
+
+    def test_clear_has_no_interval(self):
+        self.assertEqual(indicators.encode_entry(indicators.clear(9)), bytes([9, 0, 0, 0, 0, 0]))
+
+    def test_out_of_range(self):
+        for bad in [
+            indicators.flash(indicators.LED_COUNT, 100, 1),
+            indicators.flash(-1, 100, 1),
+            indicators.flash(0, 0, 1),
+            indicators.flash(0, indicators.MAX_INTERVAL_MS + 1, 1),
+            indicators.flash(0, 100, indicators.MAX_FLASHES + 1),
+            indicators.flash(0, 100, 1, (256, 0, 0)),
+        ]:
+            with self.assertRaises(ValueError, msg=repr(bad)):
+                indicators.encode_entry(bad)
+
+    def test_limits_accepted(self):
+        indicators.encode_entry(indicators.flash(indicators.LED_COUNT - 1, indicators.MAX_INTERVAL_MS, indicators.MAX_FLASHES))
+
+    def test_packets_hold_five(self):
+        entries = [indicators.flash(i, 100, 2) for i in range(12)]
+        packets = indicators.encode(entries)
+        self.assertEqual([p[0] for p in packets], [5, 5, 2])
+        self.assertTrue(all(len(rawhid.build_report(rawhid.CMD_INDICATORS, p)) == rawhid.REPORT_SIZE for p in packets))
+
+    def test_round_trip(self):
+        entries = [indicators.flash(i, 10 * (i + 1), i + 1, (i, 2 * i, 3 * i)) for i in range(5)]
+        self.assertEqual(indicators.decode(indicators.encode(entries)[0]), entries)
+
+    def test_keyboard_accepts_everything_encoded(self):
+        stub = rawhid.StubTransport(keyboard_accepts)
+        entries = [indicators.flash(i, 10 + i, 1 + (i * 13) % indicators.MAX_FLASHES) for i in range(indicators.LED_COUNT)]
+        entries += [indicators.clear(i) for i in range(0, indicators.LED_COUNT, 7)]
+        indicators.send(stub, entries)
+        self.assertEqual(len(stub.sent), -(-len(entries) // indicators.ENTRIES_PER_PACKET))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,286 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test.h"
+
+/**
+ * Sends the report sequences of QMK's action code through report_coalesce.c
+ * and checks what reaches the USB driver.
+ *
+ * register_code() and friends below build the report from the real mods and
+ * keys and send it on every change, like action.c does. set_mods() only
+ * changes the mods, the next report picks them up. wait_ms() is the stub
+ * chThdSleep(), linked with --wrap like the firmware, so the wrapper in
+ * report_coalesce.c runs first and __real_chThdSleep() notes what was sent
+ * by then. housekeeping() is the end of a main loop pass.
+ */
+
+#define NKRO_ENABLE
+
+#include "../report_coalesce.c"
+
+#define KC_A 0x04
+#define KC_B 0x05
+#define KC_BSPC 0x2A
+#define KC_DEL 0x4C
+#define MOD_LCTL 0x01
+#define MOD_LSFT 0x02
+#define MOD_RSFT 0x20
+#define MOD_MASK_SHIFT (MOD_LSFT | MOD_RSFT)
+#define TAP_CODE_DELAY 25
+
+#define MAX_SENT 16
+
+typedef enum { SENT_KEYBOARD, SENT_NKRO, SENT_MOUSE, SENT_EXTRA } sent_kind_t;
+
+typedef struct {
+    sent_kind_t       kind;
+    report_keyboard_t keyboard;
+} sent_t;
+
+static sent_t sent[MAX_SENT];
+static int    sent_count = 0;
+static int    sent_before_wait[MAX_SENT];
+static int    wait_count = 0;
+
+static host_driver_t *current_driver = NULL;
+
+static void log_report(sent_kind_t kind, const report_keyboard_t *keyboard) {
+    if (sent_count < MAX_SENT) {
+        sent[sent_count].kind = kind;
+        if (keyboard) {
+            sent[sent_count].keyboard = *keyboard;
+        }
+    }
+    sent_count++;
+}
+
+static void usb_send_keyboard(report_keyboard_t *report) {
+    log_report(SENT_KEYBOARD, report);
+}
+static void usb_send_nkro(report_nkro_t *report) {
+    log_report(SENT_NKRO, NULL);
+}
+static void usb_send_mouse(report_mouse_t *report) {
+    log_report(SENT_MOUSE, NULL);
+}
+static void usb_send_extra(report_extra_t *report) {
+    log_report(SENT_EXTRA, NULL);
+}
+
+static host_driver_t usb_driver = {NULL, usb_send_keyboard, usb_send_nkro, usb_send_mouse, usb_send_extra};
+
+void host_set_driver(host_driver_t *driver) {
+    current_driver = driver;
+}
+host_driver_t *host_get_driver(void) {
+    return current_driver;
+}
+
+void __real_chThdSleep(sysinterval_t time) {
+    if (wait_count < MAX_SENT) {
+        sent_before_wait[wait_count] = sent_count;
+    }
+    wait_count++;
+}
+
+// action.c in short, one key per report is all the sequences here need
+static uint8_t real_mods = 0;
+static uint8_t keys[KEYBOARD_REPORT_KEYS];
+
+static void send_keyboard_report(void) {
+    report_keyboard_t report = {.mods = real_mods};
+    memcpy(report.keys, keys, sizeof(keys));
+    host_get_driver()->send_keyboard(&report);
+}
+
+static void register_mods(uint8_t mods) {
+    real_mods |= mods;
+    send_keyboard_report();
+}
+static void unregister_mods(uint8_t mods) {
+    real_mods &= ~mods;
+    send_keyboard_report();
+}
+static void set_mods(uint8_t mods) {
+    real_mods = mods;
+}
+static void register_code(uint8_t code) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (keys[i] == 0) {
+            keys[i] = code;
+            break;
+        }
+    }
+    send_keyboard_report();
+}
+static void unregister_code(uint8_t code) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (keys[i] == code) {
+            keys[i] = 0;
+        }
+    }
+    send_keyboard_report();
+}
+
+// register_code16() / unregister_code16() for a shifted basic keycode
+static void tap_code_shifted(uint8_t code) {
+    register_mods(MOD_LSFT);
+    register_code(code);
+    wait_ms(TAP_CODE_DELAY);
+    unregister_code(code);
+    unregister_mods(MOD_LSFT);
+}
+
+// handle_backspace() from the keymap, one shot mods left out
+static void backspace(bool pressed) {
+    static uint8_t registered_key = 0;
+    if (pressed) {
+        const uint8_t mods       = real_mods;
+        uint8_t       shift_mods = mods & MOD_MASK_SHIFT;
+        if (shift_mods) {
+            registered_key = KC_DEL;
+            if (shift_mods != MOD_MASK_SHIFT) {
+                unregister_mods(MOD_MASK_SHIFT);
+            }
+        } else {
+            registered_key = KC_BSPC;
+        }
+        register_code(registered_key);
+        set_mods(mods);
+    } else {
+        wait_ms(TAP_CODE_DELAY);
+        unregister_code(registered_key);
+    }
+}
+
+static void housekeeping(void) {
+    report_coalesce_task();
+}
+
+static void reset(void) {
+    current_driver = &usb_driver;
+    housekeeping(); // takes over the driver
+    real_mods = 0;
+    memset(keys, 0, sizeof(keys));
+    send_keyboard_report();
+    housekeeping();
+    sent_count = 0;
+    wait_count = 0;
+}
+
+static bool sent_keys(int index, uint8_t mods, uint8_t key) {
+    return index < sent_count && sent[index].kind == SENT_KEYBOARD && sent[index].keyboard.mods == mods && sent[index].keyboard.keys[0] == key;
+}
+
+static void test_backspace(void) {
+    reset();
+    register_mods(MOD_LSFT);
+    housekeeping();
+
+    // shift + backspace: the shift release and the Del press are one report
+    backspace(true);
+    EXPECT(sent_count == 1, "%d reports before the end of the pass", sent_count);
+    housekeeping();
+    EXPECT(sent_count == 2, "shift + backspace sent %d reports, expected 1", sent_count - 1);
+    EXPECT(sent_keys(1, 0, KC_DEL), "shift + backspace didn't send Del without shift");
+
+    // the release waits first, then Del goes up with shift back
+    backspace(false);
+    housekeeping();
+    EXPECT(sent_count == 3 && sent_keys(2, MOD_LSFT, 0), "the release sent %d reports", sent_count - 2);
+
+    // both shifts stay held, Shift + Del
+    reset();
+    register_mods(MOD_MASK_SHIFT);
+    backspace(true);
+    housekeeping();
+    EXPECT(sent_count == 1 && sent_keys(0, MOD_MASK_SHIFT, KC_DEL), "both shifts + backspace sent %d reports", sent_count);
+
+    // no shift, backspace as is
+    reset();
+    backspace(true);
+    housekeeping();
+    EXPECT(sent_count == 1 && sent_keys(0, 0, KC_BSPC), "backspace sent %d reports", sent_count);
+}
+
+static void test_shifted_tap(void) {
+    reset();
+    tap_code_shifted(KC_A);
+    housekeeping();
+
+    // shift and A go down together, the wait leaves the press on the host
+    EXPECT(sent_count == 2, "a shifted tap sent %d reports, expected 2", sent_count);
+    EXPECT(sent_keys(0, MOD_LSFT, KC_A), "the press isn't shift + A");
+    EXPECT(sent_keys(1, 0, 0), "the release isn't empty");
+    EXPECT(wait_count == 1 && sent_before_wait[0] == 1, "%d reports went out before the tap delay, expected 1", sent_before_wait[0]);
+
+    // two taps in a row, each press still gets its own gap
+    reset();
+    tap_code_shifted(KC_A);
+    tap_code_shifted(KC_A);
+    housekeeping();
+    EXPECT(sent_count == 4, "two shifted taps sent %d reports, expected 4", sent_count);
+    EXPECT(sent_keys(2, MOD_LSFT, KC_A), "the second press was merged away");
+    EXPECT(wait_count == 2 && sent_before_wait[1] == 3, "%d reports went out before the second tap delay, expected 3", sent_before_wait[1]);
+}
+
+static void test_no_bit_twice(void) {
+    // a press and release with no wait between still reach the host apart
+    reset();
+    register_code(KC_A);
+    unregister_code(KC_A);
+    housekeeping();
+    EXPECT(sent_count == 2 && sent_keys(0, 0, KC_A) && sent_keys(1, 0, 0), "a press and release sent %d reports", sent_count);
+
+    // different keys merge
+    reset();
+    register_code(KC_A);
+    register_code(KC_B);
+    housekeeping();
+    EXPECT(sent_count == 1 && sent[0].keyboard.keys[1] == KC_B, "two presses sent %d reports, expected 1", sent_count);
+
+    // exact repeats are dropped, held or sent
+    reset();
+    register_code(KC_A);
+    send_keyboard_report();
+    housekeeping();
+    send_keyboard_report();
+    housekeeping();
+    EXPECT(sent_count == 1, "a repeated report was sent %d times", sent_count);
+}
+
+static void test_other_reports(void) {
+    // ctrl + click, the ctrl press lands before the click
+    reset();
+    register_mods(MOD_LCTL);
+    report_mouse_t click = {.buttons = 1};
+    host_get_driver()->send_mouse(&click);
+    EXPECT(sent_count == 2 && sent[0].kind == SENT_KEYBOARD && sent[1].kind == SENT_MOUSE, "ctrl + click went out out of order");
+
+    // a consumer usage after a key, then a repeat of it
+    reset();
+    register_code(KC_A);
+    report_extra_t volume = {.report_id = REPORT_ID_CONSUMER, .usage = 0xE9};
+    host_get_driver()->send_extra(&volume);
+    host_get_driver()->send_extra(&volume);
+    EXPECT(sent_count == 2 && sent[0].kind == SENT_KEYBOARD && sent[1].kind == SENT_EXTRA, "key + volume sent %d reports", sent_count);
+
+    // switching to NKRO sends the 6KRO report first
+    reset();
+    register_code(KC_A);
+    report_nkro_t nkro = {.report_id = REPORT_ID_NKRO};
+    host_get_driver()->send_nkro(&nkro);
+    nkro.bits[0] = 1;
+    host_get_driver()->send_nkro(&nkro);
+    housekeeping();
+    EXPECT(sent_count == 2 && sent[0].kind == SENT_KEYBOARD && sent[1].kind == SENT_NKRO, "6KRO then NKRO sent %d reports", sent_count);
+}
+
+int main(void) {
+    test_backspace();
+    test_shifted_tap();
+    test_no_bit_twice();
+    test_other_reports();
+    return TEST_RESULT();
+}
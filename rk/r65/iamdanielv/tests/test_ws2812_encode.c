@@ -0,0 +1,152 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test.h"
+
+/**
+ * Decodes the SPI bitstream ws2812_compact.c builds and checks it against
+ * the WS2812 timing: the high time of every 0 and 1 bit, the bit period and
+ * the low reset time after the data. Built once per encoding, see the Makefile.
+ */
+
+#define WS2812_LED_COUNT 66
+#define WS2812_DI_PIN 0x1F
+
+// the SPI peripheral runs from the 96MHz bus clock
+#define TEST_BUS_HZ 96000000UL
+#define TEST_SPI_HZ (TEST_BUS_HZ / WS2812_SPI_DIVISOR)
+
+// WS2812 datasheet tolerances, in ns
+#define TEST_TH_TOLERANCE 150
+#define TEST_PERIOD_TOLERANCE 600
+
+#include "../ws2812_compact.c"
+
+SPIDriver SPID1;
+
+static const uint8_t *sent_buf  = NULL;
+static size_t         sent_size = 0;
+
+void palSetLineMode(ioline_t line, iomode_t mode) {}
+void palClearLine(ioline_t line) {}
+void spiAcquireBus(SPIDriver *spip) {}
+void spiReleaseBus(SPIDriver *spip) {}
+void spiStart(SPIDriver *spip, const SPIConfig *config) {
+    spip->state = SPI_READY;
+}
+void spiStop(SPIDriver *spip) {
+    spip->state = SPI_STOP;
+}
+void spiSelect(SPIDriver *spip) {}
+void spiUnselect(SPIDriver *spip) {}
+void spiSend(SPIDriver *spip, size_t n, const void *txbuf) {
+    sent_buf  = txbuf;
+    sent_size = n;
+}
+void spiStartSend(SPIDriver *spip, size_t n, const void *txbuf) {
+    spiSend(spip, n, txbuf);
+}
+
+// SPI sends MSB first
+static inline int stream_bit(size_t bit) {
+    return (sent_buf[bit / 8] >> (7 - bit % 8)) & 1;
+}
+
+static inline uint32_t spi_bits_ns(uint32_t bits) {
+    return (uint32_t)((uint64_t)bits * 1000000000ULL / TEST_SPI_HZ);
+}
+
+static inline uint32_t ns_diff(uint32_t a, uint32_t b) {
+    return a > b ? a - b : b - a;
+}
+
+/**
+ * @brief Decodes one WS2812 data bit at `bit`, checks its shape and returns it, -1 if malformed.
+ */
+static int decode_bit(size_t bit) {
+    uint32_t high = 0;
+    while (high < WS2812_SPI_BITS && stream_bit(bit + high)) {
+        high++;
+    }
+    for (uint32_t i = high; i < WS2812_SPI_BITS; i++) {
+        if (stream_bit(bit + i)) {
+            return -1; // high again after going low
+        }
+    }
+    if (high == 0 || high == WS2812_SPI_BITS) {
+        return -1; // no pulse, or no low time
+    }
+    return high >= 2;
+}
+
+/**
+ * @brief Decodes the byte sent at LED bit `led_bit`.
+ */
+static int decode_byte(size_t led_bit) {
+    int value = 0;
+    for (int i = 0; i < 8; i++) {
+        int bit = decode_bit((led_bit + i) * WS2812_SPI_BITS);
+        if (bit < 0) {
+            return -1;
+        }
+        value = (value << 1) | bit;
+    }
+    return value;
+}
+
+static void check_timing(void) {
+    // a 0 is one high SPI bit, a 1 is WS2812_SPI_BITS - 1 of them, either way the period is WS2812_SPI_BITS
+    uint32_t t0h    = spi_bits_ns(1);
+    uint32_t t1h    = spi_bits_ns(WS2812_SPI_BITS - 1);
+    uint32_t period = spi_bits_ns(WS2812_SPI_BITS);
+
+    printf("ws2812: %u bit encoding at %lu Hz, T0H %u ns, T1H %u ns, period %u ns\n", WS2812_SPI_BITS, (unsigned long)TEST_SPI_HZ, t0h, t1h, period);
+    EXPECT(ns_diff(t0h, WS2812_T0H) <= TEST_TH_TOLERANCE, "T0H is %u ns, want %u +- %u", t0h, WS2812_T0H, TEST_TH_TOLERANCE);
+    EXPECT(ns_diff(t1h, WS2812_T1H) <= TEST_TH_TOLERANCE, "T1H is %u ns, want %u +- %u", t1h, WS2812_T1H, TEST_TH_TOLERANCE);
+    EXPECT(ns_diff(period, WS2812_TIMING) <= TEST_PERIOD_TOLERANCE, "bit period is %u ns, want %u +- %u", period, WS2812_TIMING, TEST_PERIOD_TOLERANCE);
+}
+
+static void check_values(void) {
+    // every byte value in every channel, with neighbouring LEDs holding other values
+    for (int value = 0; value < 256; value++) {
+        for (int i = 0; i < WS2812_LED_COUNT; i++) {
+            ws2812_set_color(i, value, (uint8_t)(value + i), (uint8_t)(255 - value));
+        }
+        ws2812_flush();
+        EXPECT(sent_size == sizeof(txbuf), "flush sent %zu bytes, want %zu", sent_size, sizeof(txbuf));
+
+        for (int i = 0; i < WS2812_LED_COUNT; i++) {
+            size_t led_bit = (size_t)i * 24;
+            int    g       = decode_byte(led_bit);
+            int    r       = decode_byte(led_bit + 8);
+            int    b       = decode_byte(led_bit + 16);
+            EXPECT(r == value && g == (uint8_t)(value + i) && b == (uint8_t)(255 - value), "LED %d value %d: decoded r %d g %d b %d", i, value, r, g, b);
+        }
+    }
+}
+
+static void check_reset(void) {
+    size_t data_bits  = (size_t)WS2812_LED_COUNT * 24 * WS2812_SPI_BITS;
+    size_t total_bits = sent_size * 8;
+
+    // every bit after the data is low
+    size_t low_bits = 0;
+    for (size_t bit = data_bits; bit < total_bits; bit++) {
+        EXPECT(!stream_bit(bit), "bit %zu of the reset is high", bit);
+        low_bits++;
+    }
+
+    // the last data bit ends low too, that counts towards the reset
+    uint32_t reset_ns = spi_bits_ns(low_bits + 1);
+    printf("ws2812: reset %u ns over %zu bytes\n", reset_ns, sent_size - data_bits / 8);
+    EXPECT(reset_ns >= WS2812_TRST_US * 1000UL, "reset is %u ns, want at least %u us", reset_ns, WS2812_TRST_US);
+}
+
+int main(void) {
+    ws2812_init();
+
+    check_timing();
+    check_values();
+    check_reset();
+    return TEST_RESULT();
+}
@@ -0,0 +1,141 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+#include "ws2812.h"
+#include "ws2812_compact.h"
+
+/**
+ * WS2812 over SPI with a selectable bit encoding (keyboard.json uses the custom driver).
+ *
+ * Each WS2812 bit is sent as a fixed pattern of SPI bits, the high time of the
+ * pattern tells the LED if it is a 0 or a 1:
+ *
+ *   4 bit (default):         0 -> 1000   1 -> 1110   12 bytes per LED
+ *   3 bit (WS2812_SPI_3BIT): 0 -> 100    1 -> 110     9 bytes per LED
+ *
+ * With the 3 bit encoding the SPI clock must be 3 / 1.25us = 2.4MHz, which is
+ * a divisor of 40 on the 96MHz clock. Then T0H = 417ns, T1H = 833ns,
+ * T0L = 833ns and T1L = 417ns, all within the WS2812 tolerance of 150ns.
+ */
+
+#ifndef WS2812_SPI_DRIVER
+#    define WS2812_SPI_DRIVER SPID1
+#endif
+
+#ifndef WS2812_SPI_MOSI_PAL_MODE
+#    define WS2812_SPI_MOSI_PAL_MODE 5
+#endif
+
+#ifdef WS2812_RGBW
+#    error "ws2812_compact: RGBW LEDs are not supported"
+#endif
+
+#ifdef WS2812_SPI_3BIT
+#    define WS2812_SPI_BITS 3
+#    define WS2812_BYTES_PER_COLOR 3
+#else
+#    define WS2812_SPI_BITS 4
+#    define WS2812_BYTES_PER_COLOR 4
+#endif
+
+// Low for at least WS2812_TRST_US after the data latches the colors
+#define WS2812_DATA_SIZE (WS2812_LED_COUNT * 3 * WS2812_BYTES_PER_COLOR)
+#define WS2812_RESET_SIZE ((1000 * WS2812_TRST_US * WS2812_SPI_BITS / WS2812_TIMING + 7) / 8)
+
+static uint8_t txbuf[WS2812_DATA_SIZE + WS2812_RESET_SIZE] = {0};
+
+#ifdef WS2812_SPI_3BIT
+// Every color bit b becomes 1b0, so a byte is 100 100 ... with bit k of the byte at bit 3k + 1
+#    define ENC3(b) (0x924924UL | (((b)&0x01UL) << 1) | (((b)&0x02UL) << 3) | (((b)&0x04UL) << 5) | (((b)&0x08UL) << 7) | (((b)&0x10UL) << 9) | (((b)&0x20UL) << 11) | (((b)&0x40UL) << 13) | (((b)&0x80UL) << 15))
+#    define E1(b) {(ENC3(b) >> 16) & 0xFF, (ENC3(b) >> 8) & 0xFF, ENC3(b) & 0xFF}
+#    define E4(b) E1(b), E1(b + 1), E1(b + 2), E1(b + 3)
+#    define E16(b) E4(b), E4(b + 4), E4(b + 8), E4(b + 12)
+#    define E64(b) E16(b), E16(b + 16), E16(b + 32), E16(b + 48)
+
+static const uint8_t ws2812_encoding[256][3] = {E64(0), E64(64), E64(128), E64(192)};
+
+static inline void ws2812_encode(uint8_t *out, uint8_t value) {
+    out[0] = ws2812_encoding[value][0];
+    out[1] = ws2812_encoding[value][1];
+    out[2] = ws2812_encoding[value][2];
+}
+#else
+// Two color bits per SPI byte, 1000 1000 with 0110 added to each nibble that holds a 1
+static inline void ws2812_encode(uint8_t *out, uint8_t value) {
+    for (uint8_t i = 0; i < 4; i++) {
+        uint8_t bits = value >> 6;
+        out[i]       = 0x88 | ((bits & 0x02) ? 0x60 : 0) | ((bits & 0x01) ? 0x06 : 0);
+        value <<= 2;
+    }
+}
+#endif
+
+static const SPIConfig ws2812_spi_config = {
+#if SPI_SUPPORTS_CIRCULAR == TRUE
+    false,
+#endif
+    NULL,
+    PAL_PORT(WS2812_DI_PIN),
+    PAL_PAD(WS2812_DI_PIN),
+    0,
+    0,
+    WS2812_SPI_DIVISOR,
+};
+
+void ws2812_init(void) {
+    palSetLineMode(WS2812_DI_PIN, PAL_MODE_ALTERNATE(WS2812_SPI_MOSI_PAL_MODE) | PAL_OUTPUT_TYPE_PUSHPULL | PAL_OUTPUT_SPEED_HIGHEST);
+
+    spiAcquireBus(&WS2812_SPI_DRIVER);
+    spiStart(&WS2812_SPI_DRIVER, &ws2812_spi_config);
+    spiSelect(&WS2812_SPI_DRIVER);
+}
+
+void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    uint8_t *led = &txbuf[index * 3 * WS2812_BYTES_PER_COLOR];
+
+#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
+    ws2812_encode(&led[0], green);
+    ws2812_encode(&led[WS2812_BYTES_PER_COLOR], red);
+    ws2812_encode(&led[2 * WS2812_BYTES_PER_COLOR], blue);
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
+    ws2812_encode(&led[0], red);
+    ws2812_encode(&led[WS2812_BYTES_PER_COLOR], green);
+    ws2812_encode(&led[2 * WS2812_BYTES_PER_COLOR], blue);
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
+    ws2812_encode(&led[0], blue);
+    ws2812_encode(&led[WS2812_BYTES_PER_COLOR], green);
+    ws2812_encode(&led[2 * WS2812_BYTES_PER_COLOR], red);
+#endif
+}
+
+void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+        ws2812_set_color(i, red, green, blue);
+    }
+}
+
+void ws2812_flush(void) {
+#ifdef WS2812_SPI_SYNC
+    spiSend(&WS2812_SPI_DRIVER, sizeof(txbuf), txbuf);
+#else
+    spiStartSend(&WS2812_SPI_DRIVER, sizeof(txbuf), txbuf);
+#endif
+}
+
+void ws2812_stop(void) {
+    // let a frame still going out finish first
+    while (WS2812_SPI_DRIVER.state != SPI_READY) {
+    }
+    spiUnselect(&WS2812_SPI_DRIVER);
+    spiStop(&WS2812_SPI_DRIVER);
+    spiReleaseBus(&WS2812_SPI_DRIVER);
+
+    // hold the data line low, so it doesn't feed the unpowered LEDs
+    palSetLineMode(WS2812_DI_PIN, PAL_MODE_OUTPUT_PUSHPULL);
+    palClearLine(WS2812_DI_PIN);
+}
+
+void ws2812_start(void) {
+    ws2812_init();
+}
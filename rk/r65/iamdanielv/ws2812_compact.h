@@ -0,0 +1,14 @@
+// Copyright 2025 DV (@iamdanielv)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/**
+ * @brief Stops the SPI peripheral and holds the data line low, for suspend.
+ */
+void ws2812_stop(void);
+
+/**
+ * @brief Starts the SPI peripheral again after ws2812_stop().
+ */
+void ws2812_start(void);